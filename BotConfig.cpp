@@ -0,0 +1,149 @@
+#include "BotConfig.h"
+#include "Exceptions.h"
+#include "Player.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/**
+ * @struct NamedWeight
+ * @brief A scalar weight and the name set() knows it by.
+ */
+struct NamedWeight {
+  std::string_view name;             ///< Kebab-case name.
+  float EvaluationWeights::*weight;  ///< The field.
+};
+
+constexpr NamedWeight NAMED_WEIGHTS[] = {
+    {"health", &EvaluationWeights::health},
+    {"item", &EvaluationWeights::item},
+    {"turn", &EvaluationWeights::turn},
+    {"handcuff", &EvaluationWeights::handcuff},
+    {"magnifying-glass", &EvaluationWeights::magnifyingGlass},
+    {"handsaw", &EvaluationWeights::handsaw},
+    {"shell-distribution", &EvaluationWeights::shellDistribution},
+    {"item-synergy", &EvaluationWeights::itemSynergy},
+};
+
+// Names of the item values, in ItemKind order.
+constexpr std::string_view ITEM_VALUE_NAMES[ITEM_KIND_COUNT] = {
+    "beer-value", "cigarette-value", "handcuffs-value", "handsaw-value",
+    "magnifying-glass-value"};
+
+} // namespace
+
+void EvaluationWeights::set(std::string_view name, float value) {
+  for (const auto &named : NAMED_WEIGHTS) {
+    if (named.name == name) {
+      this->*named.weight = value;
+      return;
+    }
+  }
+  for (int kind = 0; kind < ITEM_KIND_COUNT; ++kind) {
+    if (ITEM_VALUE_NAMES[kind] == name) {
+      itemValues[kind] = value;
+      return;
+    }
+  }
+  throw InvalidGameArgumentException("Unknown evaluation weight \"" +
+                                     std::string(name) + "\".");
+}
+
+void EvaluationWeights::assign(std::string_view assignment) {
+  const size_t equals = assignment.find('=');
+  if (equals == std::string_view::npos) {
+    throw InvalidGameArgumentException(
+        "Expected a weight as NAME=VALUE, got \"" + std::string(assignment) +
+        "\".");
+  }
+  const std::string text(assignment.substr(equals + 1));
+  float value = 0.0f;
+  size_t parsed = 0;
+  try {
+    value = std::stof(text, &parsed);
+  } catch (const std::invalid_argument &) {
+    parsed = 0;
+  } catch (const std::out_of_range &) {
+    parsed = 0;
+  }
+  if (parsed == 0 || parsed != text.size()) {
+    throw InvalidGameArgumentException("Weight value \"" + text +
+                                       "\" is not a valid number.");
+  }
+  set(assignment.substr(0, equals), value);
+}
+
+float EvaluationWeights::maxScore() const noexcept {
+  // Every term at its extreme for the same side: full health against none,
+  // a full inventory of the most valuable item against nothing, and every
+  // status, tempo, shell and synergy bonus at once.
+  const float maxItemValue =
+      *std::max_element(std::begin(itemValues), std::end(itemValues));
+  return health + item * static_cast<float>(MAX_ITEMS) * maxItemValue +
+         handcuff + magnifyingGlass + handsaw + turn + shellDistribution +
+         itemSynergy * MAX_SYNERGY;
+}
+
+void EvaluationWeights::validate() const {
+  for (const auto &named : NAMED_WEIGHTS) {
+    const float value = this->*named.weight;
+    if (!std::isfinite(value) || value < 0.0f) {
+      throw InvalidGameArgumentException(
+          "Evaluation weight " + std::string(named.name) +
+          " must be finite and not negative.");
+    }
+  }
+  for (int kind = 0; kind < ITEM_KIND_COUNT; ++kind) {
+    if (!std::isfinite(itemValues[kind]) || itemValues[kind] < 0.0f) {
+      throw InvalidGameArgumentException(
+          "Evaluation weight " + std::string(ITEM_VALUE_NAMES[kind]) +
+          " must be finite and not negative.");
+    }
+  }
+  // A position scored like a win would be chased instead of the win.
+  if (maxScore() >= TERMINAL_SCORE) {
+    throw InvalidGameArgumentException(
+        "Evaluation weights must keep every score below " +
+        std::to_string(static_cast<int>(TERMINAL_SCORE)) + ".");
+  }
+}
+
+bool EvaluationWeights::operator==(
+    const EvaluationWeights &other) const noexcept {
+  for (const auto &named : NAMED_WEIGHTS) {
+    if (this->*named.weight != other.*named.weight)
+      return false;
+  }
+  return std::equal(std::begin(itemValues), std::end(itemValues),
+                    std::begin(other.itemValues));
+}
+
+BotConfig BotConfig::preset(std::string_view name) {
+  BotConfig config;
+  if (name == "fast") {
+    config.limits.timeLimit = std::chrono::milliseconds{50};
+    config.minSearchDepth = 3;
+  } else if (name == "deep") {
+    config.limits.timeLimit = std::chrono::milliseconds{30000};
+  } else if (name != "standard") {
+    throw InvalidGameArgumentException("Unknown bot preset \"" +
+                                       std::string(name) +
+                                       "\"; expected fast, standard or deep.");
+  }
+  return config;
+}
+
+void BotConfig::validate() const {
+  limits.validate();
+  if (minSearchDepth < 1 || minSearchDepth > SearchLimits::MAX_DEPTH) {
+    throw InvalidGameArgumentException(
+        "Minimum search depth must be between 1 and " +
+        std::to_string(SearchLimits::MAX_DEPTH) + ".");
+  }
+  weights.validate();
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_BOTCONFIG_H
+#define BUCKSHOT_ROULETTE_BOT_BOTCONFIG_H
+
+#include "Items/Item.h"
+#include "Search/SearchLimits.h"
+#include <string_view>
+
+/**
+ * @struct EvaluationWeights
+ * @brief Weights of the heuristic that scores non-terminal positions.
+ *
+ * The defaults are the tuned standard weights.  Every weight is applied
+ * from player one's view: a bonus for player one is the same penalty for
+ * player two.
+ */
+struct EvaluationWeights {
+  // Magnitude of a won or lost position.  validate() keeps every heuristic
+  // score below it, so winning is always preferred over any "good position".
+  static constexpr float TERMINAL_SCORE = 10000.0f;
+  // Largest synergy total one side can hold (all four combos).
+  static constexpr float MAX_SYNERGY = 5.0f;
+
+  // Scales the normalized health differential (our HP vs. opponent HP).
+  // At maxHP=3, 1 HP = health / 3.  Must dominate item scores so dealing
+  // damage is always preferred over hoarding items.
+  float health = 600.0f;
+  // Scales the difference in total held item values between players.
+  // Must be low enough that the strategic weights below easily exceed the
+  // item-loss penalty from using the item (value * item).
+  float item = 1.0f;
+  // Bonus/penalty for whose turn it is (tempo advantage).
+  float turn = 50.0f;
+  // Bonus when the opponent is handcuffed (they lose a turn).  Kept moderate
+  // so that HP damage (health / maxHP ≈ 200) clearly dominates cuff
+  // preservation; otherwise the bot shoots itself just to keep an active
+  // cuff, especially when it holds spare handcuffs for re-cuffing.
+  float handcuff = 50.0f;
+  // Bonus when we know the next shell (information advantage).  High
+  // because knowing the shell enables perfect play: shoot self on blank
+  // (free turn), shoot opponent on live (guaranteed damage).
+  float magnifyingGlass = 300.0f;
+  // Bonus when the handsaw is active on our turn (double damage potential).
+  float handsaw = 80.0f;
+  // Bonus when the shell distribution is extreme (the active player can
+  // choose optimally).
+  float shellDistribution = 40.0f;
+  // Bonus per point of complementary item combos held.
+  float itemSynergy = 15.0f;
+  // Worth of one held item, indexed by ItemKind: beer ejects a shell,
+  // a cigarette restores 1 HP, handcuffs deny a turn, a handsaw doubles the
+  // next shot and a magnifying glass reveals the shell.
+  float itemValues[ITEM_KIND_COUNT] = {20.0f, 15.0f, 40.0f, 35.0f, 40.0f};
+
+  /**
+   * @brief Sets one weight by name.
+   *
+   * Names are the field names in kebab case (health, item, turn, handcuff,
+   * magnifying-glass, handsaw, shell-distribution, item-synergy) and, for
+   * item values, the item followed by "-value" (beer-value,
+   * cigarette-value, handcuffs-value, handsaw-value,
+   * magnifying-glass-value).
+   *
+   * @param name The weight's name.
+   * @param value Its new value.
+   * @throws InvalidGameArgumentException If no weight has that name.
+   */
+  void set(std::string_view name, float value);
+
+  /**
+   * @brief Sets one weight from a NAME=VALUE assignment, as the tools'
+   * --weight option takes it.
+   * @param assignment The assignment, e.g. "health=700".
+   * @throws InvalidGameArgumentException If the text is not NAME=VALUE, the
+   * value is not a number or no weight has that name.
+   */
+  void assign(std::string_view assignment);
+
+  /**
+   * @brief Bounds the magnitude of any non-terminal score.
+   * @return The largest score the heuristic can give either side.
+   */
+  [[nodiscard]] float maxScore() const noexcept;
+
+  /**
+   * @brief Checks that the weights keep the heuristic well formed.
+   * @throws InvalidGameArgumentException If a weight is negative or not
+   * finite, or a position could score as high as a win.
+   */
+  void validate() const;
+
+  /**
+   * @brief Compares every weight.
+   * @param other The weights to compare with.
+   * @return True if the weights are the same.
+   */
+  [[nodiscard]] bool operator==(const EvaluationWeights &other) const noexcept;
+
+  /**
+   * @brief Negation of operator==.
+   * @param other The weights to compare with.
+   * @return True if the weights differ.
+   */
+  [[nodiscard]] bool operator!=(const EvaluationWeights &other) const noexcept {
+    return !(*this == other);
+  }
+};
+
+/**
+ * @struct BotConfig
+ * @brief Everything that tunes how a BotPlayer searches and evaluates.
+ *
+ * Each bot holds its own copy, so bots tuned for different latencies can
+ * play in one process: a fast bot for bulk simulation beside a deep bot
+ * for showcase games.  The defaults are the standard bot.
+ */
+struct BotConfig {
+  // Standard first depth of iterative deepening.
+  static constexpr int DEFAULT_MIN_SEARCH_DEPTH = 5;
+
+  SearchLimits limits;                            ///< When deepening stops.
+  int minSearchDepth = DEFAULT_MIN_SEARCH_DEPTH;  ///< First depth searched.
+  EvaluationWeights weights;                      ///< Heuristic weights.
+
+  /**
+   * @brief Builds a named preset.
+   *
+   * "fast" answers within 50 ms, starting shallow so an iteration always
+   * completes; "standard" is the default bot; "deep" thinks for 30 seconds.
+   *
+   * @param name The preset's name.
+   * @return The preset.
+   * @throws InvalidGameArgumentException If no preset has that name.
+   */
+  [[nodiscard]] static BotConfig preset(std::string_view name);
+
+  /**
+   * @brief Checks that a bot can search with this configuration.
+   * @throws InvalidGameArgumentException If any value is out of range.
+   */
+  void validate() const;
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_BOTCONFIG_H
\ No newline at end of file
@@ -4,108 +4,96 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <future>
 #include <iostream>
 #include <limits>
 #include <memory>
 #include <unordered_map>
 
-const std::chrono::milliseconds BotPlayer::TIME_LIMIT;
 constexpr int BotPlayer::MAX_SEARCH_DEPTH;
-constexpr int BotPlayer::MIN_SEARCH_DEPTH;
 constexpr float BotPlayer::EPSILON;
+constexpr int BotPlayer::LAZY_SMP_DEPTH_SPREAD;
 
-float BotPlayer::valueOfItem(const Item *item) {
-  if (!item)
-    return 0.0f;
-
-  std::string_view name = item->getName();
-  if (name == "Beer")
-    return BEER_VALUE;
-  else if (name == "Cigarette")
-    return CIGARETTE_VALUE;
-  else if (name == "Handcuffs")
-    return HANDCUFFS_VALUE;
-  else if (name == "Magnifying Glass")
-    return MAGNIFYING_GLASS_VALUE;
-  else if (name == "Handsaw")
-    return HANDSAW_VALUE;
-
-  return 0.0f;
+float BotPlayer::evaluateState(const SearchState &state) {
+  static const EvaluationWeights standardWeights;
+  return evaluateState(state, standardWeights);
 }
 
-float BotPlayer::evaluateState(SimulatedGame *state) {
+float BotPlayer::evaluateState(const SearchState &state,
+                               const EvaluationWeights &weights) {
+  const SearchState::Side &p1 = state.players[SearchState::PLAYER_ONE];
+  const SearchState::Side &p2 = state.players[SearchState::PLAYER_TWO];
+
   // Terminal conditions: if one player's HP is zero, assign an extreme score.
-  if (!state->getPlayerOne()->isAlive())
+  if (p1.health <= 0)
     return TERMINAL_LOSS_SCORE;
-  if (!state->getPlayerTwo()->isAlive())
+  if (p2.health <= 0)
     return TERMINAL_WIN_SCORE;
 
   // All scoring is consistently from playerOne (bot) perspective.
 
   // 1. Health Differential: normalized difference.
   float healthScore =
-      HEALTH_WEIGHT * ((static_cast<float>(state->getPlayerOne()->getHealth()) /
-                        static_cast<float>(getMaxHealth())) -
-                       (static_cast<float>(state->getPlayerTwo()->getHealth()) /
-                        static_cast<float>(getMaxHealth())));
+      weights.health * ((static_cast<float>(p1.health) /
+                        static_cast<float>(state.maxHealth)) -
+                       (static_cast<float>(p2.health) /
+                        static_cast<float>(state.maxHealth)));
 
   // 2. Item Value Comparison: total held item value for each player.
   float p1ItemValue = 0.0f;
   float p2ItemValue = 0.0f;
-  try {
-    for (const auto *item : state->getPlayerOne()->getItemsView())
-      p1ItemValue += valueOfItem(item);
-    for (const auto *item : state->getPlayerTwo()->getItemsView())
-      p2ItemValue += valueOfItem(item);
-  } catch (const std::exception &) {
-    // Continue with default scores on error
+  for (int kind = 0; kind < ITEM_KIND_COUNT; ++kind) {
+    float value = weights.itemValues[kind];
+    p1ItemValue += value * static_cast<float>(p1.items[kind]);
+    p2ItemValue += value * static_cast<float>(p2.items[kind]);
   }
-  float itemScore = ITEM_WEIGHT * (p1ItemValue - p2ItemValue);
+  float itemScore = weights.item * (p1ItemValue - p2ItemValue);
 
   // 3. Status Effects: Handcuffs, Handsaw, and Magnifying Glass statuses.
   float statusScore = 0.0f;
   // Opponent cuffed is good for us; us being cuffed is bad
-  if (state->getPlayerTwo()->areHandcuffsApplied())
-    statusScore += HANDCUFF_WEIGHT;
-  if (state->getPlayerOne()->areHandcuffsApplied())
-    statusScore -= HANDCUFF_WEIGHT;
+  if (p2.handcuffed)
+    statusScore += weights.handcuff;
+  if (p1.handcuffed)
+    statusScore -= weights.handcuff;
   // Us knowing the next shell is good; opponent knowing is bad
-  if (state->getPlayerOne()->isNextShellRevealed())
-    statusScore += MAGNIFYING_GLASS_WEIGHT;
-  if (state->getPlayerTwo()->isNextShellRevealed())
-    statusScore -= MAGNIFYING_GLASS_WEIGHT;
+  if (p1.shellRevealed)
+    statusScore += weights.magnifyingGlass;
+  if (p2.shellRevealed)
+    statusScore -= weights.magnifyingGlass;
   // Saw active on our turn means we benefit; on opponent's turn they benefit
-  if (state->isPlayerOneTurnNow() && state->getShotgun()->getSawUsed())
-    statusScore += HANDSAW_WEIGHT;
-  if (!state->isPlayerOneTurnNow() && state->getShotgun()->getSawUsed())
-    statusScore -= HANDSAW_WEIGHT;
+  if (state.playerOneTurn && state.sawActive)
+    statusScore += weights.handsaw;
+  if (!state.playerOneTurn && state.sawActive)
+    statusScore -= weights.handsaw;
 
   // 4. Turn Advantage: bonus if it is our turn.
-  float turnScore = (state->isPlayerOneTurnNow() ? TURN_WEIGHT : -TURN_WEIGHT);
+  float turnScore = (state.playerOneTurn ? weights.turn : -weights.turn);
 
   // 5. Shell Distribution Favorability: extreme distributions (far from 50/50)
   // favor the active player since they can choose shoot-self (if mostly blanks)
   // or shoot-opponent (if mostly lives) optimally.
   float shellScore = 0.0f;
-  int totalShells = state->getShotgun()->getTotalShellCount();
-  if (totalShells > 0) {
-    float pLive = state->getShotgun()->getLiveShellProbability();
+  if (state.totalShells() > 0) {
+    float pLive = state.liveProbability();
     float extremity = std::abs(pLive - 0.5f) * 2.0f; // 0 at 50/50, 1 at 100%
-    shellScore = SHELL_DISTRIBUTION_WEIGHT * extremity;
-    if (!state->isPlayerOneTurnNow())
+    shellScore = weights.shellDistribution * extremity;
+    if (!state.playerOneTurn)
       shellScore = -shellScore;
   }
 
   // 6. Item Synergy: complementary item combos are worth more than their parts.
   float synergyScore = 0.0f;
-  bool p1HasCuffs = state->getPlayerOne()->hasItem("Handcuffs");
-  bool p1HasSaw = state->getPlayerOne()->hasItem("Handsaw");
-  bool p1HasMag = state->getPlayerOne()->hasItem("Magnifying Glass");
-  bool p1HasBeer = state->getPlayerOne()->hasItem("Beer");
-  bool p2HasCuffs = state->getPlayerTwo()->hasItem("Handcuffs");
-  bool p2HasSaw = state->getPlayerTwo()->hasItem("Handsaw");
-  bool p2HasMag = state->getPlayerTwo()->hasItem("Magnifying Glass");
-  bool p2HasBeer = state->getPlayerTwo()->hasItem("Beer");
+  bool p1HasCuffs = state.hasItem(SearchState::PLAYER_ONE, ItemKind::HANDCUFFS);
+  bool p1HasSaw = state.hasItem(SearchState::PLAYER_ONE, ItemKind::HANDSAW);
+  bool p1HasMag =
+      state.hasItem(SearchState::PLAYER_ONE, ItemKind::MAGNIFYING_GLASS);
+  bool p1HasBeer = state.hasItem(SearchState::PLAYER_ONE, ItemKind::BEER);
+  bool p2HasCuffs = state.hasItem(SearchState::PLAYER_TWO, ItemKind::HANDCUFFS);
+  bool p2HasSaw = state.hasItem(SearchState::PLAYER_TWO, ItemKind::HANDSAW);
+  bool p2HasMag =
+      state.hasItem(SearchState::PLAYER_TWO, ItemKind::MAGNIFYING_GLASS);
+  bool p2HasBeer = state.hasItem(SearchState::PLAYER_TWO, ItemKind::BEER);
 
   float p1Synergy = 0.0f;
   float p2Synergy = 0.0f;
@@ -121,299 +109,363 @@ float BotPlayer::evaluateState(SimulatedGame *state) {
   // Beer + Magnifying Glass: manipulate shells with information
   if (p1HasBeer && p1HasMag) p1Synergy += 0.5f;
   if (p2HasBeer && p2HasMag) p2Synergy += 0.5f;
-  synergyScore = ITEM_SYNERGY_WEIGHT * (p1Synergy - p2Synergy);
+  synergyScore = weights.itemSynergy * (p1Synergy - p2Synergy);
 
   // Total evaluation: sum of all weighted components.
   return healthScore + itemScore + statusScore + turnScore + shellScore + synergyScore;
 }
 
-bool BotPlayer::performAction(Action action, SimulatedGame *state,
-                              ShellType shell) {
-  auto *simShotgun = dynamic_cast<SimulatedShotgun *>(state->getShotgun());
-
-  // Determine current and opponent players based on whose turn it is.
-  auto *currentPlayer = (state->isPlayerOneTurnNow()) ? state->getPlayerOne()
-                                                      : state->getPlayerTwo();
-  auto *otherPlayer = (!state->isPlayerOneTurnNow()) ? state->getPlayerOne()
-                                                     : state->getPlayerTwo();
-
-  switch (action) {
-  case Action::SHOOT_SELF:
-    currentPlayer->resetKnownNextShell();
-    if (shell == ShellType::LIVE_SHELL) {
-      currentPlayer->loseHealth(simShotgun->getSawUsed());
-      simShotgun->resetSawUsed();
-      simShotgun->simulateLiveShell();
-
-      // If the opponent is handcuffed, skip their turn and allow re-cuffing.
-      if (otherPlayer->areHandcuffsApplied()) {
-        otherPlayer->removeHandcuffs();
-        currentPlayer->resetHandcuffUsage();
-        return state->isPlayerOneTurnNow();
-      } else {
-        currentPlayer->resetHandcuffUsage();
-        return !state->isPlayerOneTurnNow();
-      }
-    } else {
-      simShotgun->resetSawUsed();
-      simShotgun->simulateBlankShell();
-      return state->isPlayerOneTurnNow(); // Blank shell grants extra turn.
-    }
-
-  case Action::SHOOT_OPPONENT:
-    currentPlayer->resetKnownNextShell();
-    if (shell == ShellType::LIVE_SHELL) {
-      otherPlayer->loseHealth(simShotgun->getSawUsed());
-      simShotgun->resetSawUsed();
-      simShotgun->simulateLiveShell();
-    } else {
-      simShotgun->resetSawUsed();
-      simShotgun->simulateBlankShell();
-    }
-
-    // If the opponent is handcuffed, skip their turn and allow re-cuffing.
-    if (otherPlayer->areHandcuffsApplied()) {
-      otherPlayer->removeHandcuffs();
-      currentPlayer->resetHandcuffUsage();
-      return state->isPlayerOneTurnNow();
-    } else {
-      currentPlayer->resetHandcuffUsage();
-      return !state->isPlayerOneTurnNow();
-    }
-
-  case Action::USE_MAGNIFYING_GLASS:
-    currentPlayer->setKnownNextShell(shell);
-    currentPlayer->removeItemByName("Magnifying Glass");
-    return state->isPlayerOneTurnNow();
-
-  case Action::SMOKE_CIGARETTE:
-    currentPlayer->smokeCigarette();
-    currentPlayer->removeItemByName("Cigarette");
-    return state->isPlayerOneTurnNow();
-
-  case Action::DRINK_BEER:
-    currentPlayer->resetKnownNextShell();
-    currentPlayer->removeItemByName("Beer");
-    // Eject the shell from the shotgun (beer racks/ejects the current shell)
-    if (simShotgun) {
-      if (shell == ShellType::LIVE_SHELL)
-        simShotgun->simulateLiveShell();
-      else
-        simShotgun->simulateBlankShell();
-    }
-    return state->isPlayerOneTurnNow();
-
-  case Action::USE_HANDSAW:
-    simShotgun->useHandsaw();
-    currentPlayer->removeItemByName("Handsaw");
-    return state->isPlayerOneTurnNow();
-
-  case Action::USE_HANDCUFFS:
-    otherPlayer->applyHandcuffs();
-    currentPlayer->useHandcuffsThisTurn();
-    currentPlayer->removeItemByName("Handcuffs");
-    return state->isPlayerOneTurnNow();
-
-  default:
-    return !state->isPlayerOneTurnNow();
-  }
-}
-
-std::unique_ptr<SimulatedGame>
-BotPlayer::simulateLiveAction(SimulatedGame *state, Action action) {
-  auto nextState = std::make_unique<SimulatedGame>(*state);
-  bool newTurn = performAction(action, nextState.get(), ShellType::LIVE_SHELL);
-  nextState->changePlayerTurn(newTurn);
-  return nextState;
+float BotPlayer::valueOfOutcome(SearchState &state, Action action,
+                                ShellType shell, int depth, float alpha,
+                                float beta, SearchThread &thread) {
+  SearchState::UndoRecord undo;
+  state.apply(action, shell, undo);
+  const float value = expectiMiniMax(state, depth - 1, alpha, beta, thread);
+  state.undo(undo);
+  return value;
 }
 
-std::unique_ptr<SimulatedGame>
-BotPlayer::simulateBlankAction(SimulatedGame *state, Action action) {
-  auto nextState = std::make_unique<SimulatedGame>(*state);
-  bool newTurn = performAction(action, nextState.get(), ShellType::BLANK_SHELL);
-  nextState->changePlayerTurn(newTurn);
-  return nextState;
-}
-
-std::unique_ptr<SimulatedGame>
-BotPlayer::simulateNonProbabilisticAction(SimulatedGame *state, Action action) {
-  auto nextState = std::make_unique<SimulatedGame>(*state);
-  // For non-probabilistic actions like using items, a shell type doesn't matter
-  bool newTurn = performAction(action, nextState.get(), ShellType::LIVE_SHELL);
-  nextState->changePlayerTurn(newTurn);
-  return nextState;
-}
+int BotPlayer::chanceOutcomes(const SearchState &state, Action action,
+                              ChanceOutcome (&outcomes)[2]) {
+  // Deterministic actions have a single outcome — no shell randomness involved.
+  // The shell passed to apply() is ignored for these items.
+  if (action == Action::SMOKE_CIGARETTE || action == Action::USE_HANDSAW ||
+      action == Action::USE_HANDCUFFS) {
+    outcomes[0] = {ShellType::LIVE_SHELL, 1.0f};
+    return 1;
+  }
 
-std::pair<std::unique_ptr<SimulatedGame>, std::unique_ptr<SimulatedGame>>
-BotPlayer::simulateAction(SimulatedGame *state, Action action) {
-  if (action == Action::USE_MAGNIFYING_GLASS) {
-    // Simulate both outcomes for shell revelation.
-    auto liveReveal = std::make_unique<SimulatedGame>(*state);
-    auto *playerLive = (liveReveal->isPlayerOneTurnNow())
-                           ? liveReveal->getPlayerOne()
-                           : liveReveal->getPlayerTwo();
-    if (playerLive) {
-      playerLive->setKnownNextShell(ShellType::LIVE_SHELL);
-      performAction(Action::USE_MAGNIFYING_GLASS, liveReveal.get(),
-                    ShellType::LIVE_SHELL);
-    }
+  // If the acting player knows the next shell (from magnifying glass),
+  // treat shot and beer actions as deterministic using that knowledge.
+  const SearchState::Side &actingPlayer = state.current();
+  if (actingPlayer.shellRevealed &&
+      (action == Action::SHOOT_SELF || action == Action::SHOOT_OPPONENT ||
+       action == Action::DRINK_BEER)) {
+    outcomes[0] = {actingPlayer.knownShell, 1.0f};
+    return 1;
+  }
 
-    auto blankReveal = std::make_unique<SimulatedGame>(*state);
-    auto *playerBlank = (blankReveal->isPlayerOneTurnNow())
-                            ? blankReveal->getPlayerOne()
-                            : blankReveal->getPlayerTwo();
-    if (playerBlank) {
-      playerBlank->setKnownNextShell(ShellType::BLANK_SHELL);
-      performAction(Action::USE_MAGNIFYING_GLASS, blankReveal.get(),
-                    ShellType::BLANK_SHELL);
-    }
+  float pLive = state.liveProbability();
+  float pBlank = state.blankProbability();
 
-    return {std::move(liveReveal), std::move(blankReveal)};
-  } else if (action == Action::DRINK_BEER) {
-    // Simulate beer usage for both live and blank shell outcomes.
-    // Shell ejection is now handled inside performAction for Beer.
-    auto liveBranch = std::make_unique<SimulatedGame>(*state);
-    bool turnAfterLive = performAction(Action::DRINK_BEER, liveBranch.get(),
-                                       ShellType::LIVE_SHELL);
-    liveBranch->changePlayerTurn(turnAfterLive);
-
-    auto blankBranch = std::make_unique<SimulatedGame>(*state);
-    bool turnAfterBlank = performAction(Action::DRINK_BEER, blankBranch.get(),
-                                        ShellType::BLANK_SHELL);
-    blankBranch->changePlayerTurn(turnAfterBlank);
-
-    return {std::move(liveBranch), std::move(blankBranch)};
+  // When shell outcome is certain, only one branch needs evaluation.
+  if (std::abs(pLive - 1.0f) < EPSILON) {
+    outcomes[0] = {ShellType::LIVE_SHELL, 1.0f};
+    return 1;
+  }
+  if (std::abs(pBlank - 1.0f) < EPSILON) {
+    outcomes[0] = {ShellType::BLANK_SHELL, 1.0f};
+    return 1;
   }
 
-  // For other actions, simulate both shell outcomes
-  std::unique_ptr<SimulatedGame> liveState = simulateLiveAction(state, action);
-  std::unique_ptr<SimulatedGame> blankState =
-      simulateBlankAction(state, action);
-  return {std::move(liveState), std::move(blankState)};
+  outcomes[0] = {ShellType::LIVE_SHELL, pLive};
+  outcomes[1] = {ShellType::BLANK_SHELL, pBlank};
+  return 2;
 }
 
 // Computes the expected value of an action by branching over probabilistic
 // shell outcomes.  Deterministic actions (items) need only one branch;
 // probabilistic actions (shoot, beer, magnifying glass) require weighting the
 // live and blank outcomes by their respective probabilities.
-float BotPlayer::expectedValueForAction(SimulatedGame *state, Action action,
-                                        int depth) {
+float BotPlayer::expectedValueForAction(SearchState &state, Action action,
+                                        int depth, float alpha, float beta,
+                                        SearchThread &thread) {
   if (depth <= 0)
     return 0.0f;
 
-  // Deterministic actions have a single outcome — no shell randomness involved.
-  if (action == Action::SMOKE_CIGARETTE || action == Action::USE_HANDSAW ||
-      action == Action::USE_HANDCUFFS) {
-    auto newState = simulateNonProbabilisticAction(state, action);
-    float result = expectiMiniMax(newState.get(), depth - 1);
-    return result;
-  }
+  ChanceOutcome outcomes[2];
+  if (chanceOutcomes(state, action, outcomes) == 1)
+    return valueOfOutcome(state, action, outcomes[0].shell, depth, alpha,
+                          beta, thread);
 
-  // If the acting player knows the next shell (from magnifying glass),
-  // treat shot and beer actions as deterministic using that knowledge.
-  auto *actingPlayer = state->isPlayerOneTurnNow() ? state->getPlayerOne()
-                                                   : state->getPlayerTwo();
-  if (actingPlayer->isNextShellRevealed() &&
-      (action == Action::SHOOT_SELF || action == Action::SHOOT_OPPONENT ||
-       action == Action::DRINK_BEER)) {
-    if (actingPlayer->returnKnownNextShell() == ShellType::LIVE_SHELL) {
-      auto liveState = simulateLiveAction(state, action);
-      return expectiMiniMax(liveState.get(), depth - 1);
-    } else {
-      auto blankState = simulateBlankAction(state, action);
-      return expectiMiniMax(blankState.get(), depth - 1);
-    }
+  // Chance node: branch into both live and blank outcomes, then combine
+  // using E[V] = P(live) * V(live) + P(blank) * V(blank).
+  ++thread.counters.chanceNodes;
+  const ChanceOutcome &live = outcomes[0];
+  const ChanceOutcome &blank = outcomes[1];
+
+  // Star1: with the blank outcome anywhere between a loss and a win, the
+  // expectation can only land inside (alpha, beta) if V(live) lies inside
+  // (liveAlpha, liveBeta).  The child is searched with that window clipped
+  // to the possible values.  A bound is returned clamped to the window it
+  // failed: rounding in the rescaled windows can otherwise carry it just
+  // inside, where the caller would take it for an exact value.
+  const float liveAlpha =
+      (alpha - blank.probability * TERMINAL_WIN_SCORE) / live.probability;
+  const float liveBeta =
+      (beta - blank.probability * TERMINAL_LOSS_SCORE) / live.probability;
+  float liveLow = liveAlpha;
+  float liveHigh = liveBeta;
+  clipWindow(liveLow, liveHigh);
+  const float liveVal = valueOfOutcome(state, action, live.shell, depth,
+                                       liveLow, liveHigh, thread);
+  if (liveVal <= liveAlpha) {
+    // Even a winning blank outcome leaves the expectation at most alpha.
+    ++thread.counters.chanceCutoffs;
+    return std::min(alpha, live.probability * liveVal +
+                               blank.probability * TERMINAL_WIN_SCORE);
+  }
+  if (liveVal >= liveBeta) {
+    // Even a losing blank outcome leaves the expectation at least beta.
+    ++thread.counters.chanceCutoffs;
+    return std::max(beta, live.probability * liveVal +
+                              blank.probability * TERMINAL_LOSS_SCORE);
   }
 
-  float pLive = state->getShotgun()->getLiveShellProbability();
-  float pBlank = state->getShotgun()->getBlankShellProbability();
-
-  // When shell outcome is certain, only one branch needs evaluation.
-  if (std::abs(pLive - 1.0f) < EPSILON) {
-    auto liveState = simulateLiveAction(state, action);
-    return expectiMiniMax(liveState.get(), depth - 1);
-  } else if (std::abs(pBlank - 1.0f) < EPSILON) {
-    auto blankState = simulateBlankAction(state, action);
-    return expectiMiniMax(blankState.get(), depth - 1);
+  // V(live) is exact, so the blank outcome's window follows directly.
+  // Rounding can close a window only an ulp or two wide; it is reopened by
+  // a step each way, since an empty window returns no usable bound.
+  float blankAlpha = (alpha - live.probability * liveVal) / blank.probability;
+  float blankBeta = (beta - live.probability * liveVal) / blank.probability;
+  if (blankAlpha >= blankBeta) {
+    const float reopenedAlpha =
+        std::nextafter(blankBeta, -std::numeric_limits<float>::infinity());
+    blankBeta =
+        std::nextafter(blankAlpha, std::numeric_limits<float>::infinity());
+    blankAlpha = reopenedAlpha;
   }
+  float blankLow = blankAlpha;
+  float blankHigh = blankBeta;
+  clipWindow(blankLow, blankHigh);
+  const float blankVal = valueOfOutcome(state, action, blank.shell, depth,
+                                        blankLow, blankHigh, thread);
+
+  const float expected =
+      live.probability * liveVal + blank.probability * blankVal;
+  if (blankVal <= blankAlpha)
+    return std::min(alpha, expected);
+  if (blankVal >= blankBeta)
+    return std::max(beta, expected);
+  return expected;
+}
 
-  // Chance node: branch into both live and blank outcomes, then combine
-  // using E[V] = P(live) * V(live) + P(blank) * V(blank).
-  auto [liveState, blankState] = simulateAction(state, action);
+std::unordered_map<Action, float> BotPlayer::evaluateRootActions(
+    const SearchState &rootState, const ActionList &actions, int depth,
+    SearchControl &control, MoveOrdering &ordering, bool &interrupted) {
+  std::unordered_map<Action, float> actionValues;
+  interrupted = false;
+
+  // Lazy SMP helpers run alongside; the main thread searches sequentially.
+  if (!threadPool || parallelMode == ParallelSearchMode::LAZY_SMP) {
+    SearchState state = rootState;
+    SearchThread thread{control, ordering};
+    float best = -std::numeric_limits<float>::infinity();
+    for (auto action : actions) {
+      float actionValue;
+      try {
+        actionValue = expectedValueForAction(
+            state, action, depth, rootAlpha(best),
+            std::numeric_limits<float>::infinity(), thread);
+      } catch (const GameException &) {
+        continue;
+      }
 
-  float liveVal = 0.0f;
-  if (liveState)
-    liveVal = expectiMiniMax(liveState.get(), depth - 1);
+      // A value searched after a limit was reached is unreliable.
+      if (searchStopped(thread)) {
+        interrupted = true;
+        break;
+      }
 
-  float blankVal = 0.0f;
-  if (blankState)
-    blankVal = expectiMiniMax(blankState.get(), depth - 1);
+      actionValues[action] = actionValue;
+      best = std::max(best, actionValue);
+    }
+    retireThread(thread);
+    return actionValues;
+  }
 
-  return pLive * liveVal + pBlank * blankVal;
+  // One task per (action, outcome); each searches its own copy of the root.
+  struct RootTask {
+    Action action;
+    ChanceOutcome outcome;
+    float value = 0.0f;
+    bool failed = false;
+    bool interrupted = false;
+  };
+  std::vector<RootTask> tasks;
+  std::vector<int> firstTask;
+  for (auto action : actions) {
+    ChanceOutcome outcomes[2];
+    const int count = chanceOutcomes(rootState, action, outcomes);
+    firstTask.push_back(static_cast<int>(tasks.size()));
+    for (int i = 0; i < count; ++i)
+      tasks.push_back({action, outcomes[i]});
+  }
+  firstTask.push_back(static_cast<int>(tasks.size()));
+
+  std::vector<std::future<void>> pending;
+  pending.reserve(tasks.size());
+  for (auto &task : tasks) {
+    pending.push_back(threadPool->submit([this, &task, &rootState, depth,
+                                          &control, &ordering] {
+      // Each task starts from the calling thread's ordering and line.
+      MoveOrdering taskOrdering = ordering;
+      SearchThread thread{control, taskOrdering};
+      // Tasks still queued when a limit is reached are not worth starting.
+      if (searchStopped(thread)) {
+        task.interrupted = true;
+        return;
+      }
+      SearchState state = rootState;
+      try {
+        task.value = valueOfOutcome(
+            state, task.action, task.outcome.shell, depth,
+            -std::numeric_limits<float>::infinity(),
+            std::numeric_limits<float>::infinity(), thread);
+      } catch (const GameException &) {
+        task.failed = true;
+      }
+      task.interrupted = searchStopped(thread);
+      retireThread(thread);
+    }));
+  }
+  // Wait for every task before rethrowing, since they reference this frame.
+  for (auto &result : pending)
+    result.wait();
+  for (auto &result : pending)
+    result.get();
+
+  for (const auto &task : tasks) {
+    if (task.interrupted) {
+      interrupted = true;
+      return actionValues;
+    }
+  }
+
+  // Combine outcomes in a fixed order so the result does not depend on
+  // which worker finished first.
+  for (int i = 0; i < actions.size(); ++i) {
+    const auto slot = static_cast<size_t>(i);
+    const int begin = firstTask[slot];
+    const int end = firstTask[slot + 1];
+    bool failed = false;
+    for (int t = begin; t < end; ++t)
+      failed = failed || tasks[static_cast<size_t>(t)].failed;
+    if (failed)
+      continue;
+
+    const RootTask &first = tasks[static_cast<size_t>(begin)];
+    if (end - begin == 1) {
+      actionValues[actions[i]] = first.value;
+    } else {
+      const RootTask &second = tasks[static_cast<size_t>(begin + 1)];
+      actionValues[actions[i]] = first.outcome.probability * first.value +
+                                 second.outcome.probability * second.value;
+    }
+  }
+  return actionValues;
 }
 
 // Core expectiminimax search with alpha-beta pruning.
 // Player 1 (the bot) is the MAX player; Player 2 is the MIN player.
 // Chance nodes are handled inside expectedValueForAction, which weights
 // outcomes by shell probabilities.
-float BotPlayer::expectiMiniMax(
-    SimulatedGame *state, int depth, float alpha, float beta,
-    std::chrono::steady_clock::time_point startTime) {
-  // Bail out early if time budget is exhausted; return static evaluation.
-  if (timeExpired(startTime))
-    return evaluateState(state);
+float BotPlayer::expectiMiniMax(SearchState &state, int depth, float alpha,
+                                float beta, SearchThread &thread) {
+  // Bail out early once a limit is reached; return static evaluation.
+  if (searchStopped(thread))
+    return evaluateState(state, config.weights);
+  countNode(thread);
 
   // Base case: leaf node — evaluate the position heuristically.
-  if (depth == 0 || !state->getPlayerOne() || !state->getPlayerTwo() ||
-      !state->getShotgun() || !state->getPlayerOne()->isAlive() ||
-      !state->getPlayerTwo()->isAlive() || state->getShotgun()->isEmpty())
-    return evaluateState(state);
+  if (depth == 0 || state.players[SearchState::PLAYER_ONE].health <= 0 ||
+      state.players[SearchState::PLAYER_TWO].health <= 0 ||
+      state.totalShells() == 0) {
+    ++thread.counters.leafEvaluations;
+    return evaluateState(state, config.weights);
+  }
 
-  // Generate and prioritize legal actions to improve pruning efficiency.
-  std::vector<Action> actionsToTry;
-  try {
-    actionsToTry =
-        prioritizeStrategicActions(determineFeasibleActions(state), state);
-  } catch (const GameException &) {
-    return evaluateState(state);
-  } catch (const std::exception &) {
-    return evaluateState(state);
+  // Reuse a stored result if it was searched at least this deep and its
+  // bound settles the value within the current window.  A shallower entry
+  // still suggests which action to try first.
+  const float originalAlpha = alpha;
+  const float originalBeta = beta;
+  TranspositionEntry entry;
+  int ttAction = MoveOrdering::NO_ACTION;
+  ++thread.counters.ttProbes;
+  const bool ttHit = transpositionTable.probe(state.hash, entry);
+  if (ttHit)
+    ttAction = entry.bestMove;
+  if (ttHit && entry.depth >= depth) {
+    ++thread.counters.ttHits;
+    if (entry.bound == BoundType::EXACT) {
+      ++thread.counters.ttCutoffs;
+      return entry.value;
+    }
+    if (entry.bound == BoundType::LOWER)
+      alpha = std::max(alpha, entry.value);
+    else
+      beta = std::min(beta, entry.value);
+    if (beta <= alpha) {
+      ++thread.counters.ttCutoffs;
+      return entry.value;
+    }
   }
 
+  // Generate legal actions and order them so cutoffs come early.
+  ActionList actionsToTry = determineFeasibleActions(state);
+  thread.ordering.order(state, depth, ttAction, actionsToTry);
+
   // MAX node (Player 1) starts at -inf; MIN node (Player 2) at +inf.
-  float bestValue = state->isPlayerOneTurnNow()
+  float bestValue = state.playerOneTurn
                         ? -std::numeric_limits<float>::infinity()
                         : std::numeric_limits<float>::infinity();
+  int bestAction = MoveOrdering::NO_ACTION;
 
-  for (auto action : actionsToTry) {
+  for (int index = 0; index < actionsToTry.size(); ++index) {
+    const Action action = actionsToTry[index];
     float value;
     try {
       // Evaluate this action's expected value across chance outcomes.
-      value = expectedValueForAction(state, action, depth);
+      value = expectedValueForAction(state, action, depth, alpha, beta,
+                                     thread);
     } catch (const GameException &) {
       continue; // Skip this action if it causes a game exception
-    } catch (const std::exception &) {
-      continue; // Skip this action if it causes an exception
     }
 
-    if (state->isPlayerOneTurnNow()) {
+    if (state.playerOneTurn) {
       // MAX node: keep the highest-valued action.
-      bestValue = std::max(bestValue, value);
+      if (value > bestValue) {
+        bestValue = value;
+        bestAction = static_cast<int>(action);
+      }
       alpha = std::max(alpha, bestValue);
-      if (beta <= alpha)
+      if (beta <= alpha) {
+        thread.counters.recordCutoff(static_cast<size_t>(index));
+        thread.ordering.recordCutoff(state, depth, action);
         break; // Beta cutoff — MIN has a better option elsewhere.
+      }
     } else {
       // MIN node: keep the lowest-valued action.
-      bestValue = std::min(bestValue, value);
+      if (value < bestValue) {
+        bestValue = value;
+        bestAction = static_cast<int>(action);
+      }
       beta = std::min(beta, bestValue);
-      if (beta <= alpha)
+      if (beta <= alpha) {
+        thread.counters.recordCutoff(static_cast<size_t>(index));
+        thread.ordering.recordCutoff(state, depth, action);
         break; // Alpha cutoff — MAX has a better option elsewhere.
+      }
     }
 
-    if (timeExpired(startTime))
+    if (searchStopped(thread))
       return bestValue;
   }
 
+  // Only fully searched nodes are cached; a node whose actions all failed has
+  // no meaningful value.
+  if (std::isfinite(bestValue) && !searchStopped(thread)) {
+    BoundType bound = BoundType::EXACT;
+    if (bestValue <= originalAlpha)
+      bound = BoundType::UPPER;
+    else if (bestValue >= originalBeta)
+      bound = BoundType::LOWER;
+    // When every action failed low none stands out; keep the old suggestion.
+    if (bound == BoundType::UPPER)
+      bestAction = ttAction;
+    transpositionTable.store(state.hash, bestValue, depth, bound, bestAction);
+  }
+
   return bestValue;
 }
 
@@ -424,6 +476,68 @@ BotPlayer::BotPlayer(std::string playerName, int playerHealth,
                      Player *playerOpponent)
     : Player(std::move(playerName), playerHealth, playerOpponent) {}
 
+BotPlayer::BotPlayer(std::string playerName, int playerHealth,
+                     Player *playerOpponent, const BotConfig &botConfig)
+    : Player(std::move(playerName), playerHealth, playerOpponent) {
+  setConfig(botConfig);
+}
+
+void BotPlayer::setSearchThreads(int threads) {
+  if (threads < 1) {
+    throw InvalidGameArgumentException(
+        "Search must use at least one thread.");
+  }
+
+  searchThreads = threads;
+  if (threads == 1)
+    threadPool.reset();
+  else if (!threadPool || threadPool->size() != static_cast<size_t>(threads))
+    threadPool = std::make_unique<ThreadPool>(static_cast<size_t>(threads));
+}
+
+int BotPlayer::getSearchThreads() const noexcept { return searchThreads; }
+
+void BotPlayer::setParallelSearchMode(ParallelSearchMode mode) noexcept {
+  parallelMode = mode;
+}
+
+ParallelSearchMode BotPlayer::getParallelSearchMode() const noexcept {
+  return parallelMode;
+}
+
+void BotPlayer::setConfig(const BotConfig &botConfig) {
+  botConfig.validate();
+  config = botConfig;
+}
+
+const BotConfig &BotPlayer::getConfig() const noexcept { return config; }
+
+void BotPlayer::setSearchLimits(const SearchLimits &limits) {
+  limits.validate();
+  config.limits = limits;
+}
+
+const SearchLimits &BotPlayer::getSearchLimits() const noexcept {
+  return config.limits;
+}
+
+void BotPlayer::setTablebase(std::shared_ptr<const Tablebase> table) noexcept {
+  tablebase = std::move(table);
+}
+
+int BotPlayer::getLastSearchDepth() const noexcept { return lastSearchDepth; }
+
+float BotPlayer::getLastSearchValue() const noexcept { return lastSearchValue; }
+
+const SearchStats &BotPlayer::getLastSearchStats() const noexcept {
+  return lastSearchStats;
+}
+
+void BotPlayer::setSearchStatsCallback(
+    std::function<void(const SearchStats &)> callback) noexcept {
+  searchStatsCallback = std::move(callback);
+}
+
 Action BotPlayer::liveShellAction(Shotgun *currentShotgun) {
   if (!currentShotgun)
     return Action::SHOOT_OPPONENT;
@@ -436,16 +550,16 @@ Action BotPlayer::liveShellAction(Shotgun *currentShotgun) {
   }
 
   // If handsaw can create a guaranteed kill, use it first.
-  if (hasItem("Handsaw") && !currentShotgun->getSawUsed() &&
+  if (hasItem(ItemKind::HANDSAW) && !currentShotgun->getSawUsed() &&
       opponent->getHealth() <= 2)
     return Action::USE_HANDSAW;
 
   // If Handcuffs available, use them to control opponent's turn.
-  if (hasItem("Handcuffs") && !hasUsedHandcuffsThisTurn())
+  if (hasItem(ItemKind::HANDCUFFS) && !hasUsedHandcuffsThisTurn())
     return Action::USE_HANDCUFFS;
 
   // If a Handsaw is available and the saw hasn't been applied, use it.
-  if (hasItem("Handsaw") && !currentShotgun->getSawUsed())
+  if (hasItem(ItemKind::HANDSAW) && !currentShotgun->getSawUsed())
     return Action::USE_HANDSAW;
 
   // Shoot the opponent - don't waste turns healing when we have a confirmed
@@ -454,51 +568,136 @@ Action BotPlayer::liveShellAction(Shotgun *currentShotgun) {
   return Action::SHOOT_OPPONENT;
 }
 
-std::vector<Action>
-BotPlayer::prioritizeStrategicActions(const std::vector<Action> &actions,
-                                      SimulatedGame *state) {
-  std::vector<Action> prioritized = actions;
-
-  // Define priority categories
-  std::vector<Action> high_priority;
-  std::vector<Action> medium_priority;
-  std::vector<Action> low_priority;
-
-  auto *actingPlayer = state->isPlayerOneTurnNow() ? state->getPlayerOne()
-                                                   : state->getPlayerTwo();
-
-  for (const auto &action : actions) {
-    // High priority: known blank shell for self, known live for opponent, or
-    // magnifying glass
-    if ((action == Action::SHOOT_SELF && actingPlayer->isNextShellRevealed() &&
-         actingPlayer->returnKnownNextShell() == ShellType::BLANK_SHELL) ||
-        (action == Action::SHOOT_OPPONENT &&
-         actingPlayer->isNextShellRevealed() &&
-         actingPlayer->returnKnownNextShell() == ShellType::LIVE_SHELL) ||
-        action == Action::USE_MAGNIFYING_GLASS) {
-      high_priority.push_back(action);
-    }
-    // Medium priority: handcuffs, handsaw, beer (beer is a key tempo tool
-    // for manipulating shell odds)
-    else if (action == Action::USE_HANDCUFFS || action == Action::USE_HANDSAW ||
-             action == Action::DRINK_BEER) {
-      medium_priority.push_back(action);
+ActionList BotPlayer::prioritizeStrategicActions(ActionList actions,
+                                                 const SearchState &state) {
+  std::stable_sort(actions.begin(), actions.end(),
+                   [&state](Action first, Action second) {
+                     return MoveOrdering::strategicPriority(state, first) >
+                            MoveOrdering::strategicPriority(state, second);
+                   });
+  return actions;
+}
+
+void BotPlayer::lazySmpHelper(SearchState state, ActionList actions,
+                              int helperIndex, SearchControl &control) {
+  // Rotate the root order so helpers fill different parts of the table.
+  std::rotate(actions.begin(), actions.begin() + helperIndex % actions.size(),
+              actions.end());
+
+  MoveOrdering ordering;
+  SearchThread thread{control, ordering};
+  const int firstDepth =
+      config.minSearchDepth + 1 + (helperIndex - 1) % LAZY_SMP_DEPTH_SPREAD;
+  for (int depth = firstDepth; depth <= control.limits.maxDepth; depth++) {
+    // Narrowed like the main thread's root, so the helper's entries match
+    // the bounds the main thread will look for.
+    float best = -std::numeric_limits<float>::infinity();
+    for (auto action : actions) {
+      if (searchStopped(thread)) {
+        retireThread(thread);
+        return;
+      }
+      try {
+        best = std::max(best, expectedValueForAction(
+                                  state, action, depth, rootAlpha(best),
+                                  std::numeric_limits<float>::infinity(),
+                                  thread));
+      } catch (const GameException &) {
+        continue;
+      }
     }
-    // Low priority: other actions
-    else
-      low_priority.push_back(action);
   }
+  retireThread(thread);
+}
+
+void BotPlayer::principalVariation(const SearchState &rootState,
+                                   Action first, int depth,
+                                   PrincipalVariation &line) const {
+  SearchState state = rootState;
+  Action action = first;
+  line.length = 0;
+  while (line.length < depth) {
+    line.keys[line.length] = state.hash;
+    line.actions[line.length] = action;
+    ++line.length;
+
+    ChanceOutcome outcomes[2];
+    const int count = chanceOutcomes(state, action, outcomes);
+    const ShellType shell =
+        count == 2 && outcomes[1].probability > outcomes[0].probability
+            ? outcomes[1].shell
+            : outcomes[0].shell;
+    SearchState::UndoRecord undo;
+    state.apply(action, shell, undo);
+    if (state.players[SearchState::PLAYER_ONE].health <= 0 ||
+        state.players[SearchState::PLAYER_TWO].health <= 0 ||
+        state.totalShells() == 0)
+      return;
+
+    TranspositionEntry entry;
+    if (!transpositionTable.probe(state.hash, entry) ||
+        entry.bestMove == TranspositionEntry::NO_MOVE)
+      return;
+    action = static_cast<Action>(entry.bestMove);
+    const ActionList feasible = determineFeasibleActions(state);
+    if (std::find(feasible.begin(), feasible.end(), action) == feasible.end())
+      return;
+  }
+}
 
-  // Combine prioritized actions
-  prioritized.clear();
-  prioritized.insert(prioritized.end(), high_priority.begin(),
-                     high_priority.end());
-  prioritized.insert(prioritized.end(), medium_priority.begin(),
-                     medium_priority.end());
-  prioritized.insert(prioritized.end(), low_priority.begin(),
-                     low_priority.end());
+void BotPlayer::flushNodes(SearchThread &thread) {
+  SearchControl &control = thread.control;
+  const uint64_t nodes =
+      control.nodes.fetch_add(thread.pendingNodes, std::memory_order_relaxed) +
+      thread.pendingNodes;
+  thread.pendingNodes = 0;
+  const SearchLimits &limits = control.limits;
+  if ((limits.maxNodes > 0 && nodes >= limits.maxNodes) ||
+      (limits.timeLimit.count() > 0 &&
+       std::chrono::steady_clock::now() >= control.deadline))
+    control.stopped.store(true, std::memory_order_relaxed);
+}
 
-  return prioritized;
+void BotPlayer::retireThread(SearchThread &thread) {
+  flushNodes(thread);
+  SearchControl &control = thread.control;
+  std::lock_guard<std::mutex> lock(control.countersMutex);
+  control.counters += thread.counters;
+}
+
+Action BotPlayer::pickBestAction(
+    const std::unordered_map<Action, float> &actionValues, Action fallback) {
+  // Tie-breaking: when multiple actions share the best value,
+  // prefer offensive/impactful actions over passive ones.
+  // Priority: SHOOT_OPPONENT > HANDCUFFS > HANDSAW > MG > BEER >
+  //           SHOOT_SELF > CIGARETTE
+  // This matters when all paths lead to terminal loss — the bot
+  // should deal damage rather than waste turns or shoot itself.
+  auto actionPriority = [](Action a) -> int {
+    switch (a) {
+    case Action::SHOOT_OPPONENT: return 7;
+    case Action::USE_HANDCUFFS: return 6;
+    case Action::USE_HANDSAW: return 5;
+    case Action::USE_MAGNIFYING_GLASS: return 4;
+    case Action::DRINK_BEER: return 3;
+    case Action::SHOOT_SELF: return 2;
+    case Action::SMOKE_CIGARETTE: return 1;
+    default: return 0;
+    }
+  };
+
+  Action bestAction = fallback;
+  float best = -std::numeric_limits<float>::infinity();
+  int bestPriority = -1;
+  for (const auto &[action, value] : actionValues) {
+    int pri = actionPriority(action);
+    if (value > best || (value == best && pri > bestPriority)) {
+      best = value;
+      bestPriority = pri;
+      bestAction = action;
+    }
+  }
+  return bestAction;
 }
 
 Action BotPlayer::chooseAction(Shotgun *currentShotgun) {
@@ -507,223 +706,251 @@ Action BotPlayer::chooseAction(Shotgun *currentShotgun) {
   // probabilities, item combos, and all strategic considerations.
 
   try {
-    // Build a starting simulated state
-    auto simShotgun = std::make_unique<SimulatedShotgun>(
-        currentShotgun->getTotalShellCount(),
-        currentShotgun->getLiveShellCount(),
-        currentShotgun->getBlankShellCount(), currentShotgun->getSawUsed());
-
-    // Create simulated players using the available constructor with deep copies
-    // Use consistent names to ensure proper item management
-    auto simP1 = std::make_unique<SimulatedPlayer>("Player1", this->health);
-    auto simP2 = std::make_unique<SimulatedPlayer>("Player2",
-                                                   this->opponent->getHealth());
-
-    // Copy items manually
-    for (const auto &item : getItemsView()) {
-      if (item) {
-        auto newItem = Item::createByName(item->getName());
-        if (newItem)
-          simP1->addItem(std::move(newItem));
-      }
-    }
-
-    for (const auto &item : opponent->getItemsView()) {
-      if (item) {
-        auto newItem = Item::createByName(item->getName());
-        if (newItem)
-          simP2->addItem(std::move(newItem));
-      }
-    }
-
-    if (isNextShellRevealed())
-      simP1->setKnownNextShell(returnKnownNextShell());
-    if (opponent->isNextShellRevealed())
-      simP2->setKnownNextShell(opponent->returnKnownNextShell());
-    if (areHandcuffsApplied())
-      simP1->applyHandcuffs();
-    if (opponent->areHandcuffsApplied())
-      simP2->applyHandcuffs();
-    if (hasUsedHandcuffsThisTurn())
-      simP1->useHandcuffsThisTurn();
-    simP1->setOpponent(simP2.get());
-    simP2->setOpponent(simP1.get());
-
-    // We'll use a unique_ptr to ensure proper cleanup here
-    SimulatedPlayer *p1Ptr = simP1.release();
-    SimulatedPlayer *p2Ptr = simP2.release();
-    SimulatedShotgun *shotgunPtr = simShotgun.release();
-
-    std::unique_ptr<SimulatedGame> initState =
-        std::make_unique<SimulatedGame>(p1Ptr, p2Ptr, shotgunPtr, true);
-
-    // Now ownership of player pointers has been transferred to the
-    // SimulatedGame
+    // Build the root search position with this bot as player one.
+    lastSearchDepth = 0;
+    lastSearchValue = std::numeric_limits<float>::quiet_NaN();
+    lastSearchStats = SearchStats();
+    const auto moveStart = std::chrono::steady_clock::now();
+    const SearchState rootState =
+        SearchState::fromPlayers(*this, *opponent, *currentShotgun);
+    transpositionTable.newSearch();
 
     Action bestAction = Action::SHOOT_OPPONENT;
 
-    // Get current time for time-limited search
-    auto startTime = std::chrono::steady_clock::now();
+    // Every thread of this move's search shares its budget and deadline.
+    SearchControl control;
+    control.limits = config.limits;
+    control.deadline =
+        std::chrono::steady_clock::now() + config.limits.timeLimit;
 
     // Determine all possible actions from this state
-    std::vector<Action> actionsToTry;
-    try {
-      actionsToTry = prioritizeStrategicActions(
-          determineFeasibleActions(initState.get()), initState.get());
-    } catch (const GameException &) {
-      // Fallback to a basic set of actions if there's a game error
-      actionsToTry = {Action::SHOOT_OPPONENT, Action::SHOOT_SELF};
-    } catch (const std::exception &) {
-      // Fallback to a basic set of actions if there's an error
-      actionsToTry = {Action::SHOOT_OPPONENT, Action::SHOOT_SELF};
+    ActionList actionsToTry =
+        prioritizeStrategicActions(determineFeasibleActions(rootState),
+                                   rootState);
+
+    // Inside a covered magazine the tablebase already knows the exact value
+    // of every action, so there is nothing left to search.  The table is
+    // solved with the default weights, so a bot tuned otherwise searches.
+    if (tablebase && config.weights == EvaluationWeights() &&
+        tablebase->covers(rootState)) {
+      std::unordered_map<Action, float> actionValues;
+      for (auto action : actionsToTry) {
+        float value;
+        if (tablebase->actionValue(rootState, action, value))
+          actionValues[action] = value;
+      }
+      if (!actionValues.empty()) {
+        bestAction = pickBestAction(actionValues, bestAction);
+        lastSearchValue = actionValues[bestAction];
+        return bestAction;
+      }
     }
 
-    // Iterative deepening: search at increasing depths starting from
-    // MIN_SEARCH_DEPTH, refining the best action at each level until the
-    // time budget is exhausted or MAX_SEARCH_DEPTH is reached.
+    // Lazy SMP: helpers search ahead of the main thread through the shared
+    // transposition table.  They hold copies of the root and are stopped and
+    // joined once the search is done, or when this scope exits, however it
+    // exits.
+    struct HelperScope {
+      std::atomic<bool> &stop;
+      std::vector<std::future<void>> helpers;
+      void join() {
+        stop.store(true, std::memory_order_relaxed);
+        for (auto &helper : helpers)
+          helper.wait();
+        helpers.clear();
+      }
+      ~HelperScope() { join(); }
+    } helperScope{stopHelpers, {}};
+    stopHelpers.store(false, std::memory_order_relaxed);
+    if (threadPool && parallelMode == ParallelSearchMode::LAZY_SMP &&
+        !actionsToTry.empty()) {
+      for (int helper = 1; helper < searchThreads; helper++)
+        helperScope.helpers.push_back(threadPool->submit(
+            [this, rootState, actionsToTry, helper, &control] {
+              lazySmpHelper(rootState, actionsToTry, helper, control);
+            }));
+    }
+
+    // Killers, history and principal variation of the main thread, kept
+    // across depths.
+    MoveOrdering ordering;
+    PrincipalVariation line;
+
+    // Iterative deepening: search at increasing depths starting from the
+    // configured minimum depth, refining the best action at each level until
+    // a search limit is reached or the deepest allowed depth is done.
     // Each completed depth REPLACES the previous result (deeper = more accurate).
-    // Partial depths (timed out mid-evaluation) are discarded.
-    for (int depth = MIN_SEARCH_DEPTH; depth <= MAX_SEARCH_DEPTH; depth++) {
-      bool timeOut = false;
-      std::unordered_map<Action, float> actionValues;
+    // Partial depths (cut short mid-evaluation) are discarded.
+    const int lastDepth = config.limits.maxDepth;
+    for (int depth = std::min(config.minSearchDepth, lastDepth);
+         depth <= lastDepth; depth++) {
+      bool interrupted = false;
+      const auto iterationStart = std::chrono::steady_clock::now();
+      const uint64_t nodesBefore =
+          control.nodes.load(std::memory_order_relaxed);
+
+      // Each depth first follows the previous depth's principal variation.
+      ordering.followPrincipalVariation(line, depth);
 
       // Evaluate each action using expectedValueForAction (handles known
       // shells, deterministic items, and probabilistic branches uniformly)
-      for (auto action : actionsToTry) {
-        float actionValue;
-
-        try {
-          actionValue =
-              expectedValueForAction(initState.get(), action, depth);
-        } catch (const GameException &) {
-          continue;
-        } catch (const std::exception &) {
-          continue;
-        }
-
-        // Check for timeout after evaluation
-        if (timeExpired(startTime)) {
-          timeOut = true;
-          break;
-        }
-
-        actionValues[action] = actionValue;
-      }
+      std::unordered_map<Action, float> actionValues = evaluateRootActions(
+          rootState, actionsToTry, depth, control, ordering, interrupted);
+      lastSearchStats.iterations.push_back(
+          {depth, !interrupted,
+           control.nodes.load(std::memory_order_relaxed) - nodesBefore,
+           std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - iterationStart)});
 
       // Only use results from fully completed depths — deeper searches are
       // more accurate and should completely replace shallower results.
-      // Discard partial depths (timed out before all actions evaluated).
-      if (!timeOut) {
+      // Discard partial depths (cut short before all actions evaluated).
+      if (!interrupted) {
         // Replace previous best with this depth's best.
-        // Tie-breaking: when multiple actions share the best value,
-        // prefer offensive/impactful actions over passive ones.
-        // Priority: SHOOT_OPPONENT > HANDCUFFS > HANDSAW > MG > BEER >
-        //           SHOOT_SELF > CIGARETTE
-        // This matters when all paths lead to terminal loss — the bot
-        // should deal damage rather than waste turns or shoot itself.
-        auto actionPriority = [](Action a) -> int {
-          switch (a) {
-          case Action::SHOOT_OPPONENT: return 7;
-          case Action::USE_HANDCUFFS: return 6;
-          case Action::USE_HANDSAW: return 5;
-          case Action::USE_MAGNIFYING_GLASS: return 4;
-          case Action::DRINK_BEER: return 3;
-          case Action::SHOOT_SELF: return 2;
-          case Action::SMOKE_CIGARETTE: return 1;
-          default: return 0;
-          }
-        };
-        float depthBest = -std::numeric_limits<float>::infinity();
-        int depthBestPriority = -1;
-        for (const auto &[action, value] : actionValues) {
-          int pri = actionPriority(action);
-          if (value > depthBest ||
-              (value == depthBest && pri > depthBestPriority)) {
-            depthBest = value;
-            depthBestPriority = pri;
-            bestAction = action;
-          }
-        }
+        bestAction = pickBestAction(actionValues, bestAction);
+        lastSearchDepth = depth;
+        const auto best = actionValues.find(bestAction);
+        if (best != actionValues.end())
+          lastSearchValue = best->second;
+
+        // Search the best action first at the next depth.
+        Action *chosen =
+            std::find(actionsToTry.begin(), actionsToTry.end(), bestAction);
+        if (chosen != actionsToTry.end())
+          std::rotate(actionsToTry.begin(), chosen, chosen + 1);
+        principalVariation(rootState, bestAction, depth, line);
       }
 
-      // Break if time limit reached
-      if (timeOut) {
+      // Stop once a limit is reached, mid-depth or by the depth just done.
+      if (interrupted || control.stopped.load(std::memory_order_relaxed)) {
         break;
       }
     }
 
+    // Helpers add their counts as they finish.
+    helperScope.join();
+    lastSearchStats.nodes = control.nodes.load(std::memory_order_relaxed);
+    lastSearchStats.counters = control.counters;
+    lastSearchStats.completedDepth = lastSearchDepth;
+    if (lastSearchDepth > 0)
+      lastSearchStats.principalVariation.assign(
+          line.actions, line.actions + line.length);
+    lastSearchStats.time =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - moveStart);
+    if (searchStatsCallback)
+      searchStatsCallback(lastSearchStats);
     return bestAction;
   } catch (const GameException &e) {
     std::cerr << "Game exception in search: " << e.what() << std::endl;
+    lastSearchDepth = 0;
+    lastSearchValue = std::numeric_limits<float>::quiet_NaN();
+    lastSearchStats = SearchStats();
     // Fallback to a reasonable default strategy
-    if (hasItem("Magnifying Glass")) {
+    if (hasItem(ItemKind::MAGNIFYING_GLASS)) {
       return Action::USE_MAGNIFYING_GLASS;
-    } else if (hasItem("Handsaw") && !currentShotgun->getSawUsed()) {
+    } else if (hasItem(ItemKind::HANDSAW) && !currentShotgun->getSawUsed()) {
       return Action::USE_HANDSAW;
     } else {
       return Action::SHOOT_OPPONENT;
     }
   } catch (const std::exception &e) {
     std::cerr << "Exception in search: " << e.what() << std::endl;
+    lastSearchDepth = 0;
+    lastSearchValue = std::numeric_limits<float>::quiet_NaN();
+    lastSearchStats = SearchStats();
     return Action::SHOOT_OPPONENT;
   }
 }
 
-std::vector<Action> BotPlayer::determineFeasibleActions(SimulatedGame *state) {
-  if (!state)
-    return {Action::SHOOT_OPPONENT};
+float BotPlayer::searchToDepth(SearchState state, int depth) {
+  if (depth < 0 || depth > SearchLimits::MAX_DEPTH) {
+    throw InvalidGameArgumentException("Search depth must be between 0 and " +
+                                       std::to_string(SearchLimits::MAX_DEPTH) +
+                                       ".");
+  }
 
-  auto *actingPlayer = state->isPlayerOneTurnNow() ? state->getPlayerOne()
-                                                   : state->getPlayerTwo();
-  std::vector<Action> feasible;
+  transpositionTable.newSearch();
+  stopHelpers.store(false, std::memory_order_relaxed);
+  SearchControl control;
+  control.limits.timeLimit = std::chrono::milliseconds{0};
+  MoveOrdering ordering;
+  SearchThread thread{control, ordering};
+  const auto start = std::chrono::steady_clock::now();
+  const float value =
+      expectiMiniMax(state, depth, -std::numeric_limits<float>::infinity(),
+                     std::numeric_limits<float>::infinity(), thread);
+  retireThread(thread);
+
+  lastSearchStats = SearchStats();
+  lastSearchStats.nodes = control.nodes.load(std::memory_order_relaxed);
+  lastSearchStats.counters = control.counters;
+  lastSearchStats.completedDepth = depth;
+  lastSearchStats.time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+  lastSearchStats.iterations.push_back(
+      {depth, true, lastSearchStats.nodes, lastSearchStats.time});
+  TranspositionEntry entry;
+  if (depth > 0 && transpositionTable.probe(state.hash, entry) &&
+      entry.bestMove != TranspositionEntry::NO_MOVE) {
+    PrincipalVariation line;
+    principalVariation(state, static_cast<Action>(entry.bestMove), depth,
+                       line);
+    lastSearchStats.principalVariation.assign(line.actions,
+                                              line.actions + line.length);
+  }
+  return value;
+}
+
+void BotPlayer::clearTranspositionTable() noexcept {
+  transpositionTable.clear();
+}
 
-  if (!actingPlayer)
-    return {Action::SHOOT_OPPONENT};
+ActionList BotPlayer::determineFeasibleActions(const SearchState &state) {
+  const SearchState::Side &actingPlayer = state.current();
+  const SearchState::Side &opponentPlayer = state.other();
+  const int acting = state.currentIndex();
+  ActionList feasible;
 
   // Always consider shooting the opponent
-  feasible.push_back(Action::SHOOT_OPPONENT);
+  feasible.push(Action::SHOOT_OPPONENT);
 
   // Consider using handcuffs if available, not already used this turn,
   // and opponent is not already handcuffed (prevents indefinite turn skipping).
-  auto *opponentPlayer = state->isPlayerOneTurnNow() ? state->getPlayerTwo()
-                                                      : state->getPlayerOne();
-  if (actingPlayer->hasItem("Handcuffs") &&
-      !actingPlayer->hasUsedHandcuffsThisTurn() &&
-      opponentPlayer && !opponentPlayer->areHandcuffsApplied())
-    feasible.push_back(Action::USE_HANDCUFFS);
+  if (state.hasItem(acting, ItemKind::HANDCUFFS) &&
+      !actingPlayer.usedHandcuffsThisTurn && !opponentPlayer.handcuffed)
+    feasible.push(Action::USE_HANDCUFFS);
 
   // Use informational items if available — but skip when the shell is already
   // known (revealed or deducible from probabilities, e.g. only 1 shell left
   // or all shells are the same type).
-  if (actingPlayer->hasItem("Magnifying Glass") &&
-      !actingPlayer->isNextShellRevealed() &&
-      state->getShotgun()->getTotalShellCount() > 1 &&
-      state->getShotgun()->getLiveShellCount() > 0 &&
-      state->getShotgun()->getBlankShellCount() > 0)
-    feasible.push_back(Action::USE_MAGNIFYING_GLASS);
+  if (state.hasItem(acting, ItemKind::MAGNIFYING_GLASS) &&
+      !actingPlayer.shellRevealed && state.totalShells() > 1 &&
+      state.liveShells > 0 && state.blankShells > 0)
+    feasible.push(Action::USE_MAGNIFYING_GLASS);
 
   // Prefer to use Handsaw if available and if the saw hasn't been applied
-  if (actingPlayer->hasItem("Handsaw") && !state->getShotgun()->getSawUsed())
-    feasible.push_back(Action::USE_HANDSAW);
+  if (state.hasItem(acting, ItemKind::HANDSAW) && !state.sawActive)
+    feasible.push(Action::USE_HANDSAW);
 
   // Consider shooting self — but never when the shell is guaranteed live
   // (100% live or known live), since SHOOT_OPPONENT strictly dominates.
   {
-    bool knownLive = actingPlayer->isNextShellRevealed() &&
-                     actingPlayer->returnKnownNextShell() == ShellType::LIVE_SHELL;
-    bool certainLive = std::abs(state->getShotgun()->getLiveShellProbability() - 1.0f) < EPSILON;
+    bool knownLive = actingPlayer.shellRevealed &&
+                     actingPlayer.knownShell == ShellType::LIVE_SHELL;
+    bool certainLive = std::abs(state.liveProbability() - 1.0f) < EPSILON;
     if (!knownLive && !certainLive)
-      feasible.push_back(Action::SHOOT_SELF);
+      feasible.push(Action::SHOOT_SELF);
   }
 
   // Consider Beer if available
-  if (actingPlayer->hasItem("Beer"))
-    feasible.push_back(Action::DRINK_BEER);
+  if (state.hasItem(acting, ItemKind::BEER))
+    feasible.push(Action::DRINK_BEER);
 
   // Consider healing if health is not full
-  if (actingPlayer->hasItem("Cigarette") &&
-      (getMaxHealth() > actingPlayer->getHealth()))
-    feasible.push_back(Action::SMOKE_CIGARETTE);
+  if (state.hasItem(acting, ItemKind::CIGARETTE) &&
+      (state.maxHealth > actingPlayer.health))
+    feasible.push(Action::SMOKE_CIGARETTE);
 
   return feasible;
-}
\ No newline at end of file
+}
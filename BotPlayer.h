@@ -1,17 +1,37 @@
 #ifndef BUCKSHOT_ROULETTE_BOT_BOTPLAYER_H
 #define BUCKSHOT_ROULETTE_BOT_BOTPLAYER_H
 
+#include "BotConfig.h"
 #include "Player.h"
-#include "Simulations/SimulatedGame.h"
-#include "Simulations/SimulatedPlayer.h"
-#include "Simulations/SimulatedShotgun.h"
+#include "Search/ActionList.h"
+#include "Search/MoveOrdering.h"
+#include "Search/SearchState.h"
+#include "Search/SearchStats.h"
+#include "Search/Tablebase.h"
+#include "Search/ThreadPool.h"
+#include "Search/TranspositionTable.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <functional>
+#include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
-#include <utility>
+#include <unordered_map>
 #include <vector>
 
+/**
+ * @enum class ParallelSearchMode
+ * @brief How extra search threads are put to work in chooseAction().
+ */
+enum class ParallelSearchMode : int {
+  ROOT_SPLIT = 0, ///< Split each depth's root actions across the threads.
+  LAZY_SMP = 1    ///< Helpers search the whole root ahead, sharing the table.
+};
+
 /**
  * @class BotPlayer
  * @brief AI-controlled player using expectiminimax for decision-making.
@@ -19,166 +39,334 @@
 class BotPlayer final : public Player {
 private:
   // -- Terminal state evaluation scores --
-  // Must exceed the maximum possible heuristic evaluation (~8665) so that
+  // BotConfig::validate() keeps every heuristic evaluation below these, so
   // winning is always preferred over any non-terminal "good position".
-  static constexpr float TERMINAL_LOSS_SCORE = -10000.0f;
-  static constexpr float TERMINAL_WIN_SCORE = 10000.0f;
-
-  // -- Heuristic evaluation weights --
-  // Scales the normalized health differential (our HP vs. opponent HP).
-  // At maxHP=3, 1 HP = HEALTH_WEIGHT / 3.  Must dominate item scores
-  // so dealing damage is always preferred over hoarding items.
-  static constexpr float HEALTH_WEIGHT = 600.0f;
-  // Scales the difference in total held item values between players.
-  // Must be low enough that strategic weights (HANDCUFF_WEIGHT=100,
-  // HANDSAW_WEIGHT=80, MG_WEIGHT=300) easily exceed the item-loss
-  // penalty from using the item (value * ITEM_WEIGHT).
-  // Max item score at 1: 8 * 40 * 1 = 320 (well below terminal 10000).
-  static constexpr float ITEM_WEIGHT = 1.0f;
-  // Bonus/penalty for whose turn it is (tempo advantage).
-  static constexpr float TURN_WEIGHT = 50.0f;
-  // Bonus when the opponent is handcuffed (they lose a turn).
-  // Kept moderate so that HP damage (HEALTH_WEIGHT/maxHP ≈ 200) clearly
-  // dominates cuff preservation.  This prevents the bot from shooting itself
-  // just to avoid consuming an active handcuff effect, especially when it
-  // holds spare handcuffs for re-cuffing.
-  static constexpr float HANDCUFF_WEIGHT = 50.0f;
-  // Bonus when we know the next shell (information advantage).
-  // High value because knowing the shell enables perfect play: shoot self on
-  // blank (free turn), shoot opponent on live (guaranteed damage).
-  static constexpr float MAGNIFYING_GLASS_WEIGHT = 300.0f;
-  // Bonus when handsaw is active on our turn (double damage potential).
-  static constexpr float HANDSAW_WEIGHT = 80.0f;
-  // Bonus when shell distribution is extreme (active player can choose optimally).
-  static constexpr float SHELL_DISTRIBUTION_WEIGHT = 40.0f;
-  // Bonus for holding complementary item combos.
-  static constexpr float ITEM_SYNERGY_WEIGHT = 15.0f;
-
-  // -- Individual item values for the evaluation heuristic --
-  // Beer: ejects a shell (information/tempo gain).
-  static constexpr float BEER_VALUE = 20.0f;
-  // Cigarette: restores 1 HP.
-  static constexpr float CIGARETTE_VALUE = 15.0f;
-  // Handcuffs: denies the opponent a full turn.
-  static constexpr float HANDCUFFS_VALUE = 40.0f;
-  // Magnifying Glass: reveals shell type for optimal play.
-  static constexpr float MAGNIFYING_GLASS_VALUE = 40.0f;
-  // Handsaw: doubles next shot damage.
-  static constexpr float HANDSAW_VALUE = 35.0f;
+  static constexpr float TERMINAL_LOSS_SCORE =
+      -EvaluationWeights::TERMINAL_SCORE;
+  static constexpr float TERMINAL_WIN_SCORE =
+      EvaluationWeights::TERMINAL_SCORE;
 
   // -- Search parameters --
   // Upper bound on iterative-deepening search depth.
-  static constexpr int MAX_SEARCH_DEPTH = 20;
-  // Starting depth for iterative-deepening search.
-  static constexpr int MIN_SEARCH_DEPTH = 5;
+  static constexpr int MAX_SEARCH_DEPTH = SearchLimits::MAX_DEPTH;
   // Tolerance for floating-point probability comparisons.
   static constexpr float EPSILON = 0.0001f;
-  // Maximum wall-clock time allowed for the search.
-  // 7 seconds allows deeper searches that can see multi-step combos like
-  // MG → conditional Handsaw → shoot, avoiding wasted items.
-  static constexpr std::chrono::milliseconds TIME_LIMIT{7000};
 
   /**
-   * @brief Returns a numerical value for an item (for evaluation purposes)
-   * @param item The item to evaluate.
-   * @return A float value representing the item's worth.
+   * @struct SearchControl
+   * @brief Budget, deadline and stop flag of one search, shared by its
+   * threads.
    */
-  [[nodiscard]] static float valueOfItem(const Item *item);
+  struct SearchControl {
+    SearchLimits limits;                            ///< Limits of the search.
+    std::chrono::steady_clock::time_point deadline; ///< Valid if timed.
+    std::atomic<uint64_t> nodes{0};   ///< Nodes flushed by all threads.
+    std::atomic<bool> stopped{false}; ///< A limit was reached.
+    std::mutex countersMutex;         ///< Guards counters.
+    SearchCounters counters;          ///< Counts of retired threads.
+  };
 
   /**
-   * @brief Evaluates the favorability of a game state.
-   * @param state The game state to evaluate.
-   * @return A score representing how advantageous the state is for the bot.
+   * @struct SearchThread
+   * @brief One thread's handle on a search.
+   *
+   * Nodes are counted locally and added to the shared total in batches, so
+   * the search touches no shared counter or clock at most nodes.  Other
+   * counts stay local until the thread is retired.
    */
-  [[nodiscard]] static float evaluateState(SimulatedGame *state);
+  struct SearchThread {
+    /**
+     * @brief Joins a search with nothing counted yet.
+     * @param searchControl The search.
+     * @param moveOrdering The thread's killers and history.
+     */
+    SearchThread(SearchControl &searchControl, MoveOrdering &moveOrdering)
+        : control(searchControl), ordering(moveOrdering) {}
+
+    SearchControl &control;    ///< The search this thread works on.
+    MoveOrdering &ordering;    ///< Orders actions; owned by the caller.
+    uint64_t pendingNodes = 0; ///< Nodes not yet added to control.nodes.
+    SearchCounters counters;   ///< Counts not yet added to control.
+  };
+
+  // Search limits, first depth and evaluation weights.  The default bounds
+  // each move by 7 seconds, which allows deeper searches that can see
+  // multi-step combos like MG → conditional Handsaw → shoot, avoiding wasted
+  // items.
+  BotConfig config;
+
+  // Cached search results, kept across moves and aged per search.
+  // Shared by every search thread.
+  TranspositionTable transpositionTable;
+
+  // Number of threads searching root actions; 1 searches on the caller.
+  int searchThreads = 1;
+
+  // Workers for the root search, present only when searchThreads > 1.
+  std::unique_ptr<ThreadPool> threadPool;
+
+  // How the workers are used.
+  ParallelSearchMode parallelMode = ParallelSearchMode::ROOT_SPLIT;
+
+  // Lazy SMP helpers start this many depths apart (cycling), beginning one
+  // past the main thread's first depth.
+  static constexpr int LAZY_SMP_DEPTH_SPREAD = 3;
+
+  // Raised once the main thread has its answer so Lazy SMP helpers unwind.
+  std::atomic<bool> stopHelpers{false};
+
+  // Exact in-magazine values consulted before searching, if provided.
+  std::shared_ptr<const Tablebase> tablebase;
+
+  // Deepest search depth the last chooseAction() completed; 0 if the move
+  // came straight from the tablebase or from the error fallback.
+  int lastSearchDepth = 0;
+
+  // Value of the action the last chooseAction() picked, from this bot's
+  // view; NaN if no value was computed.
+  float lastSearchValue = std::numeric_limits<float>::quiet_NaN();
+
+  // What the last chooseAction() or searchToDepth() counted.
+  SearchStats lastSearchStats;
+
+  // Called with lastSearchStats after every searched move, if set.
+  std::function<void(const SearchStats &)> searchStatsCallback;
 
   /**
-   * @brief Simulates the result of an action.
-   * @param action The action to perform.
-   * @param state The current game state.
-   * @param shell The drawn shell type.
-   * @return Whether the turn switches.
+   * @brief Picks the highest-valued action, breaking ties by impact.
+   *
+   * When several actions share the best value, offensive actions are
+   * preferred: SHOOT_OPPONENT > HANDCUFFS > HANDSAW > MG > BEER >
+   * SHOOT_SELF > CIGARETTE.
+   *
+   * @param actionValues Value of each candidate action.
+   * @param fallback Returned when there are no candidates.
+   * @return The chosen action.
    */
-  static bool performAction(Action action, SimulatedGame *state,
-                            ShellType shell);
+  [[nodiscard]] static Action
+  pickBestAction(const std::unordered_map<Action, float> &actionValues,
+                 Action fallback);
 
   /**
-   * @brief Simulates an action with a live shell outcome.
-   * @param state The current game state.
-   * @param action The action to simulate.
-   * @return The resulting game state.
+   * @brief Alpha for a root action searched after others.
+   * @param best The best root value so far, or -infinity.
+   * @return The largest value below best, so an action tying the best is
+   * still searched exactly.
    */
-  [[nodiscard]] static std::unique_ptr<SimulatedGame>
-  simulateLiveAction(SimulatedGame *state, Action action);
+  [[nodiscard]] static float rootAlpha(float best) noexcept {
+    return std::nextafter(best, -std::numeric_limits<float>::infinity());
+  }
 
   /**
-   * @brief Simulates an action with a blank shell outcome.
-   * @param state The current game state.
-   * @param action The action to simulate.
-   * @return The resulting game state.
+   * @brief Clips a child's window to the possible values.
+   *
+   * The window is left as it is if clipping would empty it; a search with
+   * an empty window returns no usable bound.
+   *
+   * @param low The window's lower bound, raised to a loss at most.
+   * @param high The window's upper bound, lowered to a win at most.
    */
-  [[nodiscard]] static std::unique_ptr<SimulatedGame>
-  simulateBlankAction(SimulatedGame *state, Action action);
+  static void clipWindow(float &low, float &high) noexcept {
+    const float clippedLow = std::max(low, TERMINAL_LOSS_SCORE);
+    const float clippedHigh = std::min(high, TERMINAL_WIN_SCORE);
+    if (clippedLow < clippedHigh) {
+      low = clippedLow;
+      high = clippedHigh;
+    }
+  }
 
   /**
-   * @brief Simulates an action with both possible shell outcomes.
-   * @param state The current game state.
-   * @param action The action to simulate.
-   * @return A pair of game states: { stateIfLive, stateIfBlank }.
+   * @brief Searches one shell outcome of an action.
+   *
+   * Applies the action to the state, searches the resulting position and
+   * reverts the action before returning.
+   *
+   * @param state The current game state, restored on return.
+   * @param action The action to play.
+   * @param shell The shell outcome to play it with.
+   * @param depth The remaining search depth.
+   * @param alpha Alpha bound for the resulting position.
+   * @param beta Beta bound for the resulting position.
+   * @param thread The searching thread.
+   * @return The value of the resulting position.
    */
-  [[nodiscard]] static std::pair<std::unique_ptr<SimulatedGame>,
-                                 std::unique_ptr<SimulatedGame>>
-  simulateAction(SimulatedGame *state, Action action);
+  [[nodiscard]] float valueOfOutcome(SearchState &state, Action action,
+                                     ShellType shell, int depth, float alpha,
+                                     float beta, SearchThread &thread);
 
   /**
    * @brief Computes the expected value for a given action.
-   * @param state The current game state.
+   *
+   * Outcomes are searched with Star1 windows: knowing every value lies
+   * between TERMINAL_LOSS_SCORE and TERMINAL_WIN_SCORE, each outcome gets
+   * the window its value must fall in for the expectation to land inside
+   * (alpha, beta).  If an outcome falls outside its window, the remaining
+   * outcomes cannot bring the expectation back and they are not searched.
+   * Values outside (alpha, beta) are bounds, as at MAX/MIN nodes.
+   *
+   * @param state The current game state, restored on return.
    * @param action The action to evaluate.
    * @param depth The remaining search depth.
+   * @param alpha Alpha value for pruning (best value for MAX).
+   * @param beta Beta value for pruning (best value for MIN).
+   * @param thread The searching thread.
    * @return The expected value of performing the action on the state.
    */
-  [[nodiscard]] float expectedValueForAction(SimulatedGame *state,
-                                             Action action, int depth);
+  [[nodiscard]] float expectedValueForAction(SearchState &state,
+                                             Action action, int depth,
+                                             float alpha, float beta,
+                                             SearchThread &thread);
 
   /**
    * @brief Expectiminimax search algorithm.
-   * @param state The current game state.
+   * @param state The current game state, restored on return.
    * @param depth Search depth.
    * @param alpha Alpha value for pruning (best value for MAX)
    * @param beta Beta value for pruning (best value for MIN)
-   * @param startTime Start time of the search for time-limited search
+   * @param thread The searching thread; its search's limits apply.
    * @return The expected value of the state.
    */
-  [[nodiscard]] float
-  expectiMiniMax(SimulatedGame *state, int depth,
-                 float alpha = -std::numeric_limits<float>::infinity(),
-                 float beta = std::numeric_limits<float>::infinity(),
-                 std::chrono::steady_clock::time_point startTime =
-                     std::chrono::steady_clock::now());
+  [[nodiscard]] float expectiMiniMax(SearchState &state, int depth,
+                                     float alpha, float beta,
+                                     SearchThread &thread);
 
   /**
-   * @brief Directly simulates actions that don't involve probabilistic shell
-   * outcomes.
-   * @param state The current game state.
-   * @param action The non-probabilistic action (item usage).
-   * @return The resulting game state.
+   * @brief Searches every root action at one depth.
+   *
+   * Searched on one thread, each action after the first gets a window just
+   * below the best value so far: only the best action needs an exact value,
+   * and any action that cannot reach it comes back as an upper bound below
+   * it.  Actions tying the best stay inside the window, so pickBestAction()
+   * still breaks ties by impact.
+   *
+   * With more than one search thread, each (action, outcome) pair runs as a
+   * separate task on the pool with a full window, so no task depends on
+   * another's result.  Outcome values are combined in the same order as
+   * expectedValueForAction, whatever order the tasks finish in.
+   *
+   * @param rootState The position to search from.
+   * @param actions The root actions to evaluate.
+   * @param depth The search depth.
+   * @param control The search, shared by every task.
+   * @param ordering Killers, history and principal variation of the
+   * calling thread, kept across depths; tasks on the pool use copies.
+   * @param interrupted Set to true if a limit was reached before all
+   * actions were searched.
+   * @return The value (or, searched on one thread, a bound below the best)
+   * of each action that could be searched.
+   */
+  [[nodiscard]] std::unordered_map<Action, float>
+  evaluateRootActions(const SearchState &rootState,
+                      const ActionList &actions, int depth,
+                      SearchControl &control, MoveOrdering &ordering,
+                      bool &interrupted);
+
+  /**
+   * @brief Follows the stored best actions from the root.
+   *
+   * At each chance node the line takes the likelier shell.  It ends at a
+   * leaf, after depth actions, or where the transposition table has no
+   * best action.
+   *
+   * @param rootState The root position.
+   * @param first The action chosen at the root.
+   * @param depth The depth just completed.
+   * @param line Receives the line.
+   */
+  void principalVariation(const SearchState &rootState, Action first,
+                          int depth, PrincipalVariation &line) const;
+
+  /**
+   * @brief Runs one Lazy SMP helper until stopped or out of budget.
+   *
+   * The helper iterates depths starting ahead of the main thread, visiting
+   * the root actions in a rotated order.  Its values are discarded; only the
+   * transposition table entries it leaves behind help the main thread.
+   *
+   * @param state Private copy of the root position.
+   * @param actions Private copy of the root actions.
+   * @param helperIndex 1-based helper number, used to stagger the helpers.
+   * @param control The search.
    */
-  [[nodiscard]] static std::unique_ptr<SimulatedGame>
-  simulateNonProbabilisticAction(SimulatedGame *state, Action action);
+  void lazySmpHelper(SearchState state, ActionList actions,
+                     int helperIndex, SearchControl &control);
 
   /**
-   * @brief Checks if the current search should be aborted due to time
-   * constraints.
-   * @param startTime The start time of the search.
-   * @return True if time limit has been reached.
+   * @brief Counts a node, checking the limits every NODE_CHECK_INTERVAL.
+   * @param thread The searching thread.
    */
-  [[nodiscard]] static bool
-  timeExpired(const std::chrono::steady_clock::time_point &startTime) {
-    auto elapsedTime = std::chrono::steady_clock::now() - startTime;
-    return elapsedTime > TIME_LIMIT;
+  static void countNode(SearchThread &thread) {
+    if (++thread.pendingNodes >= SearchLimits::NODE_CHECK_INTERVAL)
+      flushNodes(thread);
+  }
+
+  /**
+   * @brief Adds a thread's pending nodes to its search and checks the
+   * budget and the clock, stopping the search if either ran out.
+   * @param thread The searching thread.
+   */
+  static void flushNodes(SearchThread &thread);
+
+  /**
+   * @brief Flushes a finished thread's nodes and adds its counts to its
+   * search.
+   * @param thread The searching thread, which must not search again.
+   */
+  static void retireThread(SearchThread &thread);
+
+  /**
+   * @brief Checks whether the current search should unwind.
+   * @param thread The searching thread.
+   * @return True if a limit was reached or helpers have been told to stop.
+   */
+  [[nodiscard]] bool searchStopped(const SearchThread &thread) const {
+    return stopHelpers.load(std::memory_order_relaxed) ||
+           thread.control.stopped.load(std::memory_order_relaxed);
   }
 
 public:
+  /**
+   * @struct ChanceOutcome
+   * @brief One shell outcome of an action and its probability.
+   */
+  struct ChanceOutcome {
+    ShellType shell;   ///< The shell drawn or revealed.
+    float probability; ///< Chance of this outcome.
+  };
+
+  /**
+   * @brief Evaluates the favorability of a game state with the standard
+   * weights.
+   * @param state The game state to evaluate.
+   * @return A score representing how advantageous the state is for the bot.
+   */
+  [[nodiscard]] static float evaluateState(const SearchState &state);
+
+  /**
+   * @brief Evaluates the favorability of a game state.
+   * @param state The game state to evaluate.
+   * @param weights The heuristic weights.
+   * @return A score representing how advantageous the state is for the bot.
+   */
+  [[nodiscard]] static float evaluateState(const SearchState &state,
+                                           const EvaluationWeights &weights);
+
+  /**
+   * @brief Lists the shell outcomes an action has to be searched under.
+   *
+   * Items other than beer and the magnifying glass, shots with a revealed
+   * shell and magazines of a single shell type have one certain outcome;
+   * anything else has a live outcome followed by a blank one.
+   *
+   * @param state The current game state.
+   * @param action The action to play.
+   * @param outcomes Receives the outcomes, live first.
+   * @return The number of outcomes written (1 or 2).
+   */
+  [[nodiscard]] static int chanceOutcomes(const SearchState &state,
+                                         Action action,
+                                         ChanceOutcome (&outcomes)[2]);
+
   /**
    * @brief Constructs a bot player.
    * @param name The bot's name.
@@ -194,6 +382,136 @@ public:
    */
   BotPlayer(std::string name, int health, Player *opponent);
 
+  /**
+   * @brief Constructs a configured bot player with an opponent.
+   * @param name The bot's name.
+   * @param health Initial health.
+   * @param opponent Pointer to the opponent.
+   * @param botConfig How the bot searches and evaluates.
+   * @throws InvalidGameArgumentException If the configuration is invalid.
+   */
+  BotPlayer(std::string name, int health, Player *opponent,
+            const BotConfig &botConfig);
+
+  /**
+   * @brief Sets how many threads search root actions in chooseAction().
+   * @param threads Thread count; 1 searches on the calling thread.
+   * @throws InvalidGameArgumentException If threads is less than 1.
+   */
+  void setSearchThreads(int threads);
+
+  /**
+   * @brief Gets how many threads search root actions.
+   * @return Thread count.
+   */
+  [[nodiscard]] int getSearchThreads() const noexcept;
+
+  /**
+   * @brief Selects how extra search threads are used.
+   *
+   * Has no effect with a single search thread, which always searches exactly
+   * as the sequential engine does.
+   *
+   * @param mode The parallel search mode.
+   */
+  void setParallelSearchMode(ParallelSearchMode mode) noexcept;
+
+  /**
+   * @brief Gets how extra search threads are used.
+   * @return The parallel search mode.
+   */
+  [[nodiscard]] ParallelSearchMode getParallelSearchMode() const noexcept;
+
+  /**
+   * @brief Sets how the bot searches and evaluates.
+   * @param botConfig The configuration.
+   * @throws InvalidGameArgumentException If the configuration is invalid.
+   */
+  void setConfig(const BotConfig &botConfig);
+
+  /**
+   * @brief Gets how the bot searches and evaluates.
+   * @return The configuration.
+   */
+  [[nodiscard]] const BotConfig &getConfig() const noexcept;
+
+  /**
+   * @brief Sets when chooseAction() stops deepening.
+   * @param limits The limits.
+   * @throws InvalidGameArgumentException If the limits are invalid.
+   */
+  void setSearchLimits(const SearchLimits &limits);
+
+  /**
+   * @brief Gets when chooseAction() stops deepening.
+   * @return The limits.
+   */
+  [[nodiscard]] const SearchLimits &getSearchLimits() const noexcept;
+
+  /**
+   * @brief Provides an endgame tablebase to answer covered positions.
+   *
+   * chooseAction() plays straight from the table whenever the current
+   * position is covered, without searching.  The table is solved with the
+   * default evaluation weights, so a bot with other weights ignores it.
+   *
+   * @param table The tablebase, or nullptr to always search.
+   */
+  void setTablebase(std::shared_ptr<const Tablebase> table) noexcept;
+
+  /**
+   * @brief Gets the depth the last chooseAction() searched to.
+   * @return Deepest completed depth, or 0 if the move was not searched.
+   */
+  [[nodiscard]] int getLastSearchDepth() const noexcept;
+
+  /**
+   * @brief Gets the value of the action the last chooseAction() picked.
+   * @return The value from this bot's view, or NaN if none was computed.
+   */
+  [[nodiscard]] float getLastSearchValue() const noexcept;
+
+  /**
+   * @brief Gets what the last chooseAction() or searchToDepth() counted.
+   *
+   * A move played from the tablebase, or by the error fallback, leaves
+   * empty statistics.
+   *
+   * @return The statistics.
+   */
+  [[nodiscard]] const SearchStats &getLastSearchStats() const noexcept;
+
+  /**
+   * @brief Sets a function called with the statistics of every move
+   * chooseAction() searches.
+   *
+   * It runs on the thread calling chooseAction(), after the search.
+   *
+   * @param callback The function, or an empty one to stop calling.
+   */
+  void setSearchStatsCallback(
+      std::function<void(const SearchStats &)> callback) noexcept;
+
+  /**
+   * @brief Searches a position to a fixed depth, ignoring the search limits.
+   *
+   * Runs the same expectiminimax search as chooseAction() on the calling
+   * thread, so benchmarks and analysis tools get repeatable work.  Entries
+   * from earlier searches are kept; call clearTranspositionTable() first
+   * for a cold search.
+   *
+   * @param state The position, with this bot as player one.
+   * @param depth The search depth, 0..SearchLimits::MAX_DEPTH.
+   * @return The expected value of the position.
+   * @throws InvalidGameArgumentException If depth is out of range.
+   */
+  [[nodiscard]] float searchToDepth(SearchState state, int depth);
+
+  /**
+   * @brief Forgets every cached search result.
+   */
+  void clearTranspositionTable() noexcept;
+
   /**
    * @brief Guaranteed live shell choices.
    * @param currentShotgun The current shotgun state.
@@ -213,18 +531,22 @@ public:
    * @param state The simulated game state.
    * @return A list of possible actions.
    */
-  [[nodiscard]] static std::vector<Action>
-  determineFeasibleActions(SimulatedGame *state);
+  [[nodiscard]] static ActionList
+  determineFeasibleActions(const SearchState &state);
 
   /**
    * @brief Prioritizes certain strategic actions for more effective play.
-   * @param actions Vector of feasible actions.
+   *
+   * Orders by MoveOrdering::strategicPriority(), keeping the generated
+   * order among equals.  This is the static order used at the root; inner
+   * nodes also use the transposition table, killers and history.
+   *
+   * @param actions The feasible actions.
    * @param state The current game state.
    * @return The prioritized list of actions.
    */
-  [[nodiscard]] static std::vector<Action>
-  prioritizeStrategicActions(const std::vector<Action> &actions,
-                             SimulatedGame *state);
+  [[nodiscard]] static ActionList
+  prioritizeStrategicActions(ActionList actions, const SearchState &state);
 };
 
 #endif // BUCKSHOT_ROULETTE_BOT_BOTPLAYER_H
\ No newline at end of file
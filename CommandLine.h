@@ -0,0 +1,50 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_COMMANDLINE_H
+#define BUCKSHOT_ROULETTE_BOT_COMMANDLINE_H
+
+#include "Exceptions.h"
+#include <charconv>
+#include <limits>
+#include <string>
+#include <system_error>
+
+/**
+ * @class CommandLine
+ * @brief Argument parsing shared by the command-line tools.
+ */
+class CommandLine {
+public:
+  /**
+   * @brief Reads a whole argument as an integer.
+   *
+   * Unlike std::stoi, trailing characters, a leading '+' or whitespace and
+   * values out of range are rejected rather than ignored or thrown as
+   * standard exceptions, so a tool can report its usage line instead of
+   * aborting.
+   *
+   * @tparam T Integer type of the value; unsigned types reject a sign.
+   * @param text The argument.
+   * @param min Smallest value that makes sense for the argument.
+   * @return The value.
+   * @throws InvalidGameArgumentException If text is not a number of type T
+   * of at least min.
+   */
+  template <typename T>
+  [[nodiscard]] static T parseNumber(const std::string &text,
+                                     T min = std::numeric_limits<T>::min()) {
+    T value{};
+    const char *end = text.data() + text.size();
+    const auto [stop, error] = std::from_chars(text.data(), end, value);
+    if (text.empty() || error != std::errc() || stop != end) {
+      throw InvalidGameArgumentException("\"" + text +
+                                         "\" is not a valid number.");
+    }
+    if (value < min) {
+      throw InvalidGameArgumentException("\"" + text +
+                                         "\" must be at least " +
+                                         std::to_string(min) + ".");
+    }
+    return value;
+  }
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_COMMANDLINE_H
\ No newline at end of file
@@ -68,4 +68,31 @@ public:
       : GameException(message) {}
 };
 
+/**
+ * @brief Thrown when an endgame tablebase cannot be read or written.
+ */
+class TablebaseException : public GameException {
+public:
+  explicit TablebaseException(const std::string &message)
+      : GameException(message) {}
+};
+
+/**
+ * @brief Thrown when a game record file cannot be read or written.
+ */
+class GameRecordException : public GameException {
+public:
+  explicit GameRecordException(const std::string &message)
+      : GameException(message) {}
+};
+
+/**
+ * @brief Thrown when a replayed game stops matching its record.
+ */
+class ReplayDesyncException : public GameException {
+public:
+  explicit ReplayDesyncException(const std::string &message)
+      : GameException(message) {}
+};
+
 #endif // BUCKSHOT_ROULETTE_BOT_EXCEPTIONS_H
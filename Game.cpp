@@ -1,8 +1,10 @@
 #include "Game.h"
 #include "BotPlayer.h"
-#include "Items/Beer.h"
+#include "GameEventSink.h"
 #include <chrono>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -16,44 +18,58 @@ const std::string blue = "\033[34m";
 } // namespace Color
 
 Game::Game(Player *pOne, Player *pTwo, bool playerOneTurn)
+    : Game(pOne, pTwo, playerOneTurn, Random::randomSeed()) {}
+
+Game::Game(Player *pOne, Player *pTwo, bool playerOneTurn, uint64_t gameSeed)
     : playerOne(pOne), playerTwo(pTwo), shotgun(std::make_unique<Shotgun>()),
       currentRound(1), playerOneWins(0), playerTwoWins(0),
-      isPlayerOneTurn(playerOneTurn) {}
+      isPlayerOneTurn(playerOneTurn), seed(gameSeed),
+      rng(Random::makeEngine(gameSeed)),
+      eventSink(&ConsoleEventSink::instance()) {
+  if (playerOne)
+    config.maxHealth = playerOne->getMaxHealth();
+}
+
+Game::Game(Player *pOne, Player *pTwo, bool playerOneTurn, uint64_t gameSeed,
+           const GameConfig &gameConfig)
+    : Game(pOne, pTwo, playerOneTurn, gameSeed) {
+  gameConfig.validate();
+  config = gameConfig;
+  for (Player *player : {playerOne, playerTwo}) {
+    if (player) {
+      player->setMaxHealth(config.maxHealth);
+      player->resetHealth();
+    }
+  }
+}
 
 void Game::distributeItems() {
-  static std::random_device rd;
-  static std::mt19937 gen(rd());
-  std::uniform_int_distribution<int> itemCountDist(MIN_ITEMS_PER_ROUND,
-                                                     MAX_ITEMS_PER_ROUND);
-  int itemCount = itemCountDist(gen);
+  std::uniform_int_distribution<int> itemCountDist(config.minItemsPerRound,
+                                                     config.maxItemsPerRound);
+  int itemCount = itemCountDist(rng);
 
-  std::vector<std::string_view> itemTypes = {
-      "Cigarette", "Handsaw", "Magnifying Glass", "Beer", "Handcuffs"};
+  static constexpr ItemKind itemTypes[] = {
+      ItemKind::CIGARETTE, ItemKind::HANDSAW, ItemKind::MAGNIFYING_GLASS,
+      ItemKind::BEER, ItemKind::HANDCUFFS};
 
   std::uniform_int_distribution<int> typeDist(
-      0, static_cast<int>(itemTypes.size()) - 1);
+      0, static_cast<int>(std::size(itemTypes)) - 1);
 
   // Distribute items to player one
   for (int i = 0; i < itemCount; i++) {
     if (playerOne->getItemCount() < MAX_ITEMS) {
-      int index = typeDist(gen);
-      auto newItem = Item::createByName(itemTypes[index]);
-      if (newItem && playerOne->addItem(std::move(newItem))) {
-        std::cout << playerOne->getName()
-                  << " received item: " << itemTypes[index] << "\n";
-      }
+      ItemKind kind = itemTypes[typeDist(rng)];
+      if (playerOne->addItem(kind))
+        emit(GameEvent::itemReceived(0, kind));
     }
   }
 
   // Distribute items to player two
   for (int i = 0; i < itemCount; i++) {
     if (playerTwo->getItemCount() < MAX_ITEMS) {
-      int index = typeDist(gen);
-      auto newItem = Item::createByName(itemTypes[index]);
-      if (newItem && playerTwo->addItem(std::move(newItem))) {
-        std::cout << playerTwo->getName()
-                  << " received item: " << itemTypes[index] << "\n";
-      }
+      ItemKind kind = itemTypes[typeDist(rng)];
+      if (playerTwo->addItem(kind))
+        emit(GameEvent::itemReceived(1, kind));
     }
   }
 }
@@ -81,6 +97,7 @@ void Game::printHeader(const std::string &title, int width) {
 bool Game::performAction(Action action) {
   Player *currentPlayer = isPlayerOneTurn ? playerOne : playerTwo;
   Player *otherPlayer = isPlayerOneTurn ? playerTwo : playerOne;
+  const int seat = isPlayerOneTurn ? 0 : 1;
 
   bool turnEnds = true;
   auto *maybeBot = dynamic_cast<BotPlayer *>(currentPlayer);
@@ -88,19 +105,16 @@ bool Game::performAction(Action action) {
   switch (action) {
   case Action::SHOOT_SELF: {
     ShellType currentShell = shotgun->getNextShell();
-    std::cout << currentPlayer->getName() << " shoots themself."
-              << "\n";
 
     if (currentShell == ShellType::LIVE_SHELL) {
       currentPlayer->loseHealth(shotgun->getSawUsed());
-      std::cout << "The shell was live. " << currentPlayer->getName()
-                << " lost health."
-                << "\n";
     } else {
-      std::cout << "The shell was blank. An extra turn was gained."
-                << "\n";
       turnEnds = false;
     }
+    emit(GameEvent::shotFired(seat, seat, currentShell));
+    if (!currentPlayer->isAlive())
+      emit(GameEvent::playerEliminated(seat, seat));
+
     shotgun->resetSawUsed();
     currentPlayer->resetKnownNextShell();
     break;
@@ -108,22 +122,12 @@ bool Game::performAction(Action action) {
 
   case Action::SHOOT_OPPONENT: {
     ShellType currentShell = shotgun->getNextShell();
-    std::cout << currentPlayer->getName() << " shoots "
-              << otherPlayer->getName() << "\n";
 
-    if (currentShell == ShellType::LIVE_SHELL) {
-      std::cout << "The shell was live. " << otherPlayer->getName()
-                << " lost health."
-                << "\n";
+    if (currentShell == ShellType::LIVE_SHELL)
       otherPlayer->loseHealth(shotgun->getSawUsed());
-
-      if (!otherPlayer->isAlive())
-        std::cout << otherPlayer->getName() << " has been eliminated!"
-                  << "\n";
-      turnEnds = true;
-    } else
-      std::cout << "The shell was blank."
-                << "\n";
+    emit(GameEvent::shotFired(seat, 1 - seat, currentShell));
+    if (!otherPlayer->isAlive())
+      emit(GameEvent::playerEliminated(seat, 1 - seat));
 
     shotgun->resetSawUsed();
     currentPlayer->resetKnownNextShell();
@@ -131,70 +135,65 @@ bool Game::performAction(Action action) {
   }
 
   case Action::SMOKE_CIGARETTE: {
-    if (currentPlayer->useItemByName("Cigarette"))
-      turnEnds = false;
-    else {
-      std::cout << currentPlayer->getName() << " has no Cigarette to smoke."
-                << "\n";
-      turnEnds = false;
-    }
+    if (currentPlayer->useItem(ItemKind::CIGARETTE))
+      emit(GameEvent::itemUsed(seat, ItemKind::CIGARETTE));
+    else
+      emit(GameEvent::itemUnavailable(seat, ItemKind::CIGARETTE));
+    turnEnds = false;
     break;
   }
 
   case Action::USE_HANDCUFFS: {
     if (!currentPlayer->hasUsedHandcuffsThisTurn() &&
         !otherPlayer->areHandcuffsApplied() &&
-        currentPlayer->useItemByName("Handcuffs")) {
+        currentPlayer->useItem(ItemKind::HANDCUFFS)) {
       otherPlayer->applyHandcuffs();
       currentPlayer->useHandcuffsThisTurn();
-      std::cout << otherPlayer->getName() << " is now handcuffed."
-                << "\n";
-      turnEnds = false;
+      emit(GameEvent::itemUsed(seat, ItemKind::HANDCUFFS));
     } else {
-      std::cout << currentPlayer->getName()
-                << " has no Handcuffs or has already used them this turn."
-                << "\n";
-      turnEnds = false;
+      emit(GameEvent::itemUnavailable(seat, ItemKind::HANDCUFFS));
     }
+    turnEnds = false;
     break;
   }
 
   case Action::USE_MAGNIFYING_GLASS: {
-    if (maybeBot)
-      maybeBot->setKnownNextShell(shotgun->revealNextShell());
-
-    if (currentPlayer->useItemByName("Magnifying Glass", shotgun.get()))
-      turnEnds = false;
-    else {
-      std::cout << currentPlayer->getName() << " has no Magnifying Glass."
-                << "\n";
-      turnEnds = false;
+    if (currentPlayer->hasItem(ItemKind::MAGNIFYING_GLASS)) {
+      const ShellType revealed = shotgun->revealNextShell();
+      if (maybeBot)
+        maybeBot->setKnownNextShell(revealed);
+      (void)currentPlayer->useItem(ItemKind::MAGNIFYING_GLASS, shotgun.get());
+      // Only a human's reveal is narrated; a bot keeps it to itself.
+      emit(GameEvent::itemUsed(seat, ItemKind::MAGNIFYING_GLASS, revealed,
+                               maybeBot != nullptr));
+    } else {
+      emit(GameEvent::itemUnavailable(seat, ItemKind::MAGNIFYING_GLASS));
     }
+    turnEnds = false;
     break;
   }
 
   case Action::DRINK_BEER: {
-    if (currentPlayer->useItemByName("Beer", shotgun.get())) {
+    if (currentPlayer->hasItem(ItemKind::BEER)) {
+      const ShellType ejected = shotgun->revealNextShell();
+      (void)currentPlayer->useItem(ItemKind::BEER, shotgun.get());
       // Beer ejects the current shell, so any previously revealed shell
       // knowledge (from Magnifying Glass) is now stale and must be cleared.
       currentPlayer->resetKnownNextShell();
-      turnEnds = false;
+      emit(GameEvent::itemUsed(seat, ItemKind::BEER, ejected));
     } else {
-      std::cout << currentPlayer->getName() << " has no Beer."
-                << "\n";
-      turnEnds = false;
+      emit(GameEvent::itemUnavailable(seat, ItemKind::BEER));
     }
+    turnEnds = false;
     break;
   }
 
   case Action::USE_HANDSAW: {
-    if (currentPlayer->useItemByName("Handsaw", shotgun.get())) {
-      turnEnds = false;
-    } else {
-      std::cout << currentPlayer->getName() << " has no Handsaw."
-                << "\n";
-      turnEnds = false;
-    }
+    if (currentPlayer->useItem(ItemKind::HANDSAW, shotgun.get()))
+      emit(GameEvent::itemUsed(seat, ItemKind::HANDSAW));
+    else
+      emit(GameEvent::itemUnavailable(seat, ItemKind::HANDSAW));
+    turnEnds = false;
     break;
   }
   }
@@ -228,18 +227,14 @@ bool Game::checkRoundEnd() const noexcept {
 }
 
 bool Game::handleRoundEnd() {
-  printDivider(WIDE_DISPLAY_WIDTH);
-
   if (!playerTwo->isAlive()) {
-    std::cout << playerOne->getName() << " wins the round!"
-              << "\n";
     playerTwo->removeHandcuffs();
     playerOneWins++;
+    emit(GameEvent::roundWon(0));
   } else if (!playerOne->isAlive()) {
-    std::cout << playerTwo->getName() << " wins the round!"
-              << "\n";
     playerOne->removeHandcuffs();
     playerTwoWins++;
+    emit(GameEvent::roundWon(1));
   }
 
   playerOne->resetHealth();
@@ -251,28 +246,61 @@ bool Game::handleRoundEnd() {
   playerOne->resetHandcuffUsage();
   playerTwo->resetHandcuffUsage();
 
-  if (playerOneWins >= ROUNDS_TO_WIN) {
-    std::cout << Color::yellow << playerOne->getName()
-              << " wins the game by winning " << ROUNDS_TO_WIN << " rounds!"
-              << Color::reset << "\n";
-    return true;
-  } else if (playerTwoWins >= ROUNDS_TO_WIN) {
-    std::cout << Color::yellow << playerTwo->getName()
-              << " wins the game by winning " << ROUNDS_TO_WIN << " rounds!"
-              << Color::reset << "\n";
+  if (playerOneWins >= config.roundsToWin ||
+      playerTwoWins >= config.roundsToWin)
     return true;
-  }
 
   // Set up next round
   distributeItems();
-  shotgun->loadShells();
-  std::this_thread::sleep_for(SHELL_LOAD_DELAY);
-  printShells();
+  loadShotgun();
   currentRound++;
 
   // Update turn order for the next round
   isPlayerOneTurn = !isPlayerOneTurn;
 
+  showRoundStandings();
+
+  return false; // The Game continues
+}
+
+void Game::loadShotgun() {
+  shotgun->loadShells(rng);
+  emit(GameEvent::shellsLoaded(shotgun->getLiveShellCount(),
+                               shotgun->getBlankShellCount(),
+                               shotgun->getShellBits()));
+  pause(SHELL_LOAD_DELAY);
+  printShells();
+}
+
+void Game::emit(const GameEvent &event) { eventSink->onEvent(event, *this); }
+
+Action Game::requestAction(Player &currentPlayer) {
+  return currentPlayer.chooseAction(shotgun.get());
+}
+
+void Game::pause(std::chrono::milliseconds delay) {
+  std::this_thread::sleep_for(delay);
+}
+
+void Game::showGameStart() {
+  printHeader("Buckshot Roulette", WIDE_DISPLAY_WIDTH);
+  std::cout << Color::blue << "Good luck to both players!" << Color::reset
+            << "\n\n";
+}
+
+void Game::showTurn(const Player &currentPlayer) {
+  std::cout << "\n";
+  printHeader("Player Status", WIDE_DISPLAY_WIDTH);
+  std::cout << *playerOne << "\n";
+  std::cout << *playerTwo << "\n";
+  printDivider(WIDE_DISPLAY_WIDTH);
+
+  currentPlayer.printItems();
+
+  std::cout << currentPlayer.getName() << "'s turn:\n";
+}
+
+void Game::showRoundStandings() {
   std::cout << "\n";
   printHeader("Round " + std::to_string(currentRound), WIDE_DISPLAY_WIDTH);
   std::cout << playerOne->getName() << " has " << playerOneWins
@@ -282,19 +310,21 @@ bool Game::handleRoundEnd() {
             << " round wins."
             << "\n";
   printDivider(WIDE_DISPLAY_WIDTH);
+}
 
-  return false; // The Game continues
+void Game::showGameOver(const Player &winner) {
+  std::cout << Color::yellow << winner.getName()
+            << " wins the game by winning " << config.roundsToWin
+            << " rounds!" << Color::reset << "\n";
+  std::cout << "\n";
+  printHeader("Game Over!", WIDE_DISPLAY_WIDTH);
 }
 
 void Game::runGame() {
-  printHeader("Buckshot Roulette", WIDE_DISPLAY_WIDTH);
-  std::cout << Color::blue << "Good luck to both players!" << Color::reset
-            << "\n\n";
+  showGameStart();
 
   distributeItems();
-  shotgun->loadShells();
-  std::this_thread::sleep_for(SHELL_LOAD_DELAY);
-  printShells();
+  loadShotgun();
 
   while (true) {
     if (checkRoundEnd()) {
@@ -304,39 +334,39 @@ void Game::runGame() {
     }
 
     if (shotgun->isEmpty()) {
-      std::cout << "\nShotgun is empty. Reloading...\n";
+      emit(GameEvent::magazineEmpty());
       // Clear stale shell knowledge before reloading.
       playerOne->resetKnownNextShell();
       playerTwo->resetKnownNextShell();
       distributeItems();
-      shotgun->loadShells();
-      std::this_thread::sleep_for(SHELL_LOAD_DELAY);
-      printShells();
+      loadShotgun();
     }
 
-    std::cout << "\n";
-    printHeader("Player Status", WIDE_DISPLAY_WIDTH);
-    std::cout << *playerOne << "\n";
-    std::cout << *playerTwo << "\n";
-    printDivider(WIDE_DISPLAY_WIDTH);
-
     Player *currentPlayer = isPlayerOneTurn ? playerOne : playerTwo;
-    currentPlayer->printItems();
+    showTurn(*currentPlayer);
 
-    std::cout << currentPlayer->getName() << "'s turn:\n";
-    Action action = currentPlayer->chooseAction(shotgun.get());
+    Action action = requestAction(*currentPlayer);
+    const int seat = isPlayerOneTurn ? 0 : 1;
 
-    // Pause before bot actions so the human player can follow along.
-    if (dynamic_cast<BotPlayer *>(currentPlayer))
-      std::this_thread::sleep_for(BOT_ACTION_DELAY);
+    // Report the choice, with the bot's search result if it searched, and
+    // pause before bot actions so the human player can follow along.
+    if (auto *bot = dynamic_cast<BotPlayer *>(currentPlayer)) {
+      emit(GameEvent::actionChosen(seat, action, bot->getLastSearchDepth(),
+                                   bot->getLastSearchValue()));
+      pause(BOT_ACTION_DELAY);
+    } else {
+      emit(GameEvent::actionChosen(seat, action, 0,
+                                   std::numeric_limits<float>::quiet_NaN()));
+    }
 
     bool turnEnds = performAction(action);
 
     determineTurnOrder(turnEnds);
   }
 
-  std::cout << "\n";
-  printHeader("Game Over!", WIDE_DISPLAY_WIDTH);
+  const bool playerOneWon = playerOneWins >= config.roundsToWin;
+  emit(GameEvent::gameWon(playerOneWon ? 0 : 1));
+  showGameOver(playerOneWon ? *playerOne : *playerTwo);
 }
 
 Player *Game::getPlayerOne() const noexcept { return playerOne; }
@@ -353,4 +383,12 @@ void Game::changePlayerTurn(bool playerOneTurn) noexcept {
 
 int Game::getPlayerOneWins() const noexcept { return playerOneWins; }
 
-int Game::getPlayerTwoWins() const noexcept { return playerTwoWins; }
\ No newline at end of file
+int Game::getPlayerTwoWins() const noexcept { return playerTwoWins; }
+
+uint64_t Game::getSeed() const noexcept { return seed; }
+
+const GameConfig &Game::getConfig() const noexcept { return config; }
+
+void Game::setEventSink(GameEventSink &sink) noexcept { eventSink = &sink; }
+
+GameEventSink &Game::getEventSink() const noexcept { return *eventSink; }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #ifndef BUCKSHOT_ROULETTE_BOT_GAME_H
 #define BUCKSHOT_ROULETTE_BOT_GAME_H
 
+#include "GameConfig.h"
 #include "Player.h"
+#include "Random.h"
 #include "Shotgun.h"
 #include <chrono>
 #include <functional>
@@ -10,18 +12,21 @@
 #include <random>
 #include <string>
 
+class GameEventSink;
+struct GameEvent;
+
 /**
  * @brief Manages the game loop, rounds, and turn order.
  *
- * Supports Human vs. Bot and Bot vs. Bot modes.
+ * Supports Human vs. Bot and Bot vs. Bot modes.  runGame() and
+ * handleRoundEnd() hold the rules; asking players to move, pauses and the
+ * console status display go through the virtual hooks below, which
+ * subclasses such as HeadlessGame override without touching the rules.  What happens during
+ * play (shots, items, round results) is reported as GameEvent records to a
+ * GameEventSink rather than printed, so the rules never format text.
  */
 class Game {
 protected:
-  // Number of round wins required to win the match.
-  static constexpr int ROUNDS_TO_WIN = 3;
-  // Number of items each player receives per distribution phase.
-  static constexpr int MIN_ITEMS_PER_ROUND = 2;
-  static constexpr int MAX_ITEMS_PER_ROUND = 5;
   // Default column width for console output formatting.
   static constexpr int DEFAULT_DISPLAY_WIDTH = 50;
   // Wider column width used for round headers and dividers.
@@ -31,6 +36,7 @@ protected:
   // Pause duration (ms) between bot actions so humans can follow along.
   static constexpr std::chrono::milliseconds BOT_ACTION_DELAY{1500};
 
+  GameConfig config;                ///< Rules of this game.
   Player *playerOne;                ///< Pointer to player one (non-owning).
   Player *playerTwo;                ///< Pointer to player two (non-owning).
   std::unique_ptr<Shotgun> shotgun; ///< Game's shotgun instance.
@@ -38,6 +44,9 @@ protected:
   int playerOneWins;                ///< Player one's win count.
   int playerTwoWins;                ///< Player two's win count.
   bool isPlayerOneTurn;             ///< Tracks whose turn it is.
+  uint64_t seed;                    ///< Seed of `rng`.
+  Random::Engine rng;               ///< Loads shells and deals items.
+  GameEventSink *eventSink;         ///< Receives events (non-owning).
 
   /**
    * @brief Checks if the round has ended due to player death.
@@ -51,15 +60,95 @@ protected:
    */
   bool handleRoundEnd();
 
+  /**
+   * @brief Loads a fresh magazine and announces it.
+   */
+  void loadShotgun();
+
+  /**
+   * @brief Reports an event to the game's sink.
+   * @param event The event.
+   */
+  void emit(const GameEvent &event);
+
+  /**
+   * @brief Asks the player to move for their next action.
+   * @param currentPlayer The player to move.
+   * @return The action to play.
+   */
+  virtual Action requestAction(Player &currentPlayer);
+
+  /**
+   * @brief Waits so a human can follow the game.
+   * @param delay How long to wait.
+   */
+  virtual void pause(std::chrono::milliseconds delay);
+
+  /**
+   * @brief Displays the banner that opens a game.
+   */
+  virtual void showGameStart();
+
+  /**
+   * @brief Displays both players' status and whose turn it is.
+   * @param currentPlayer The player about to act.
+   */
+  virtual void showTurn(const Player &currentPlayer);
+
+  /**
+   * @brief Displays the round number and standings as a new round begins.
+   */
+  virtual void showRoundStandings();
+
+  /**
+   * @brief Displays the match result.
+   * @param winner The player who reached config.roundsToWin.
+   */
+  virtual void showGameOver(const Player &winner);
+
 public:
   /**
-   * @brief Initializes a new game instance.
+   * @brief Initializes a new game instance with the standard rules.
+   *
+   * The players keep their own health; the game's max health is taken from
+   * player one.  Events go to ConsoleEventSink::instance() until
+   * setEventSink() is called.
+   *
    * @param p1 Pointer to player one.
    * @param p2 Pointer to player two.
    * @param isPlayerOneTurn Is it player one's turn?
    */
   Game(Player *p1, Player *p2, bool isPlayerOneTurn);
 
+  /**
+   * @brief Initializes a new game whose shells and items follow a seed.
+   *
+   * Two games built from the same seed load the same shells and deal the
+   * same items for as long as their players make the same choices.
+   *
+   * @param p1 Pointer to player one.
+   * @param p2 Pointer to player two.
+   * @param isPlayerOneTurn Is it player one's turn?
+   * @param seed Seed of the game's engine, e.g. Random::gameSeed().
+   */
+  Game(Player *p1, Player *p2, bool isPlayerOneTurn, uint64_t seed);
+
+  /**
+   * @brief Initializes a seeded game with its own rules.
+   *
+   * Both players' max health is set to the configured value and their
+   * health refilled to it.
+   *
+   * @param p1 Pointer to player one.
+   * @param p2 Pointer to player two.
+   * @param isPlayerOneTurn Is it player one's turn?
+   * @param seed Seed of the game's engine, e.g. Random::gameSeed().
+   * @param config The rules.
+   * @throws InvalidGameArgumentException If the rules are invalid.
+   */
+  Game(Player *p1, Player *p2, bool isPlayerOneTurn, uint64_t seed,
+       const GameConfig &config);
+
   /**
    * @brief Virtual destructor.
    */
@@ -148,6 +237,30 @@ public:
    * @return Number of rounds won by player two.
    */
   [[nodiscard]] int getPlayerTwoWins() const noexcept;
+
+  /**
+   * @brief Gets the seed the game's engine was created from.
+   * @return The seed.
+   */
+  [[nodiscard]] uint64_t getSeed() const noexcept;
+
+  /**
+   * @brief Gets the rules this game is played by.
+   * @return The configuration.
+   */
+  [[nodiscard]] const GameConfig &getConfig() const noexcept;
+
+  /**
+   * @brief Sends the game's events to another sink.
+   * @param sink The sink (non-owning); must outlive the game or be replaced.
+   */
+  void setEventSink(GameEventSink &sink) noexcept;
+
+  /**
+   * @brief Gets the sink receiving the game's events.
+   * @return The sink.
+   */
+  [[nodiscard]] GameEventSink &getEventSink() const noexcept;
 };
 
 #endif // BUCKSHOT_ROULETTE_BOT_GAME_H
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "GameConfig.h"
+#include "Exceptions.h"
+#include "Player.h"
+#include "Search/Zobrist.h"
+#include <string>
+
+void GameConfig::validate() const {
+  // The search keeps health in a signed byte and hashes it per value.
+  if (maxHealth < 1 || maxHealth >= Zobrist::MAX_TRACKED_HEALTH) {
+    throw InvalidGameArgumentException(
+        "Max health must be between 1 and " +
+        std::to_string(Zobrist::MAX_TRACKED_HEALTH - 1) + ".");
+  }
+  if (roundsToWin < 1) {
+    throw InvalidGameArgumentException("Rounds to win must be positive.");
+  }
+  if (minItemsPerRound < 0 || minItemsPerRound > maxItemsPerRound ||
+      maxItemsPerRound > MAX_ITEMS) {
+    throw InvalidGameArgumentException(
+        "Items per round must satisfy 0 <= min <= max <= " +
+        std::to_string(MAX_ITEMS) + ".");
+  }
+}
\ No newline at end of file
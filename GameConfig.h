@@ -0,0 +1,32 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_GAMECONFIG_H
+#define BUCKSHOT_ROULETTE_BOT_GAMECONFIG_H
+
+/**
+ * @struct GameConfig
+ * @brief Rules that may differ from one game to the next.
+ *
+ * Each Game holds its own copy, so games with different rules can run side
+ * by side in one process.  The defaults are the standard rules.
+ */
+struct GameConfig {
+  // Standard health each player starts every round with.
+  static constexpr int DEFAULT_MAX_HEALTH = 3;
+  // Standard number of round wins required to win the match.
+  static constexpr int DEFAULT_ROUNDS_TO_WIN = 3;
+  // Standard range of items each player receives per distribution phase.
+  static constexpr int DEFAULT_MIN_ITEMS_PER_ROUND = 2;
+  static constexpr int DEFAULT_MAX_ITEMS_PER_ROUND = 5;
+
+  int maxHealth = DEFAULT_MAX_HEALTH;         ///< Health cap of both players.
+  int roundsToWin = DEFAULT_ROUNDS_TO_WIN;    ///< Round wins to take a match.
+  int minItemsPerRound = DEFAULT_MIN_ITEMS_PER_ROUND; ///< Fewest items dealt.
+  int maxItemsPerRound = DEFAULT_MAX_ITEMS_PER_ROUND; ///< Most items dealt.
+
+  /**
+   * @brief Checks that the rules can be played and searched.
+   * @throws InvalidGameArgumentException If any value is out of range.
+   */
+  void validate() const;
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_GAMECONFIG_H
\ No newline at end of file
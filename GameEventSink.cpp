@@ -0,0 +1,277 @@
+#include "GameEventSink.h"
+#include "Exceptions.h"
+#include "Game.h"
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace {
+// Width of the divider printed above a round result.
+constexpr int ROUND_DIVIDER_WIDTH = 60;
+
+/**
+ * @brief Name of the player in a seat.
+ * @param game The game.
+ * @param seat 0 for player one, 1 for player two.
+ * @return The player's name.
+ */
+std::string_view nameOf(const Game &game, uint8_t seat) {
+  return (seat == 0 ? game.getPlayerOne() : game.getPlayerTwo())->getName();
+}
+
+/**
+ * @brief Narrates a successful item use.
+ * @param event The ITEM_USED event.
+ * @param game The game.
+ */
+void printItemUsed(const GameEvent &event, const Game &game) {
+  const std::string_view user = nameOf(game, event.seat);
+  switch (event.item) {
+  case ItemKind::BEER:
+    std::cout << user
+              << " uses Beer to eject the current shell from the shotgun.\n";
+    std::cout << "The racked shell is a " << event.shell << ".\n";
+    break;
+  case ItemKind::CIGARETTE:
+    std::cout << user << " uses Cigarette and restores 1 HP.\n";
+    break;
+  case ItemKind::HANDCUFFS:
+    std::cout << user << " uses Handcuffs on " << nameOf(game, event.target)
+              << ", causing them to miss their next turn.\n";
+    std::cout << nameOf(game, event.target) << " is now handcuffed.\n";
+    break;
+  case ItemKind::HANDSAW:
+    std::cout << user
+              << " uses a Handsaw to modify the shotgun, doubling the damage "
+                 "of the next live round.\n";
+    break;
+  case ItemKind::MAGNIFYING_GLASS:
+    std::cout << user
+              << " uses a Magnifying Glass to inspect the shotgun's chamber.\n";
+    if (!event.hidden)
+      std::cout << "The shell in the chamber is " << event.shell << "\n";
+    break;
+  }
+}
+
+/**
+ * @brief Narrates an item that could not be used.
+ * @param event The ITEM_UNAVAILABLE event.
+ * @param game The game.
+ */
+void printItemUnavailable(const GameEvent &event, const Game &game) {
+  std::cout << nameOf(game, event.seat);
+  switch (event.item) {
+  case ItemKind::BEER:
+    std::cout << " has no Beer.\n";
+    break;
+  case ItemKind::CIGARETTE:
+    std::cout << " has no Cigarette to smoke.\n";
+    break;
+  case ItemKind::HANDCUFFS:
+    std::cout << " has no Handcuffs or has already used them this turn.\n";
+    break;
+  case ItemKind::HANDSAW:
+    std::cout << " has no Handsaw.\n";
+    break;
+  case ItemKind::MAGNIFYING_GLASS:
+    std::cout << " has no Magnifying Glass.\n";
+    break;
+  }
+}
+} // namespace
+
+GameEvent GameEvent::itemReceived(int seat, ItemKind item) noexcept {
+  GameEvent event{GameEventType::ITEM_RECEIVED};
+  event.seat = static_cast<uint8_t>(seat);
+  event.item = item;
+  return event;
+}
+
+GameEvent GameEvent::shellsLoaded(int live, int blank,
+                                  uint16_t shells) noexcept {
+  GameEvent event{GameEventType::SHELLS_LOADED};
+  event.live = static_cast<uint8_t>(live);
+  event.blank = static_cast<uint8_t>(blank);
+  event.shells = shells;
+  return event;
+}
+
+GameEvent GameEvent::magazineEmpty() noexcept {
+  return GameEvent{GameEventType::MAGAZINE_EMPTY};
+}
+
+GameEvent GameEvent::shotFired(int seat, int target, ShellType shell) noexcept {
+  GameEvent event{GameEventType::SHOT_FIRED};
+  event.seat = static_cast<uint8_t>(seat);
+  event.target = static_cast<uint8_t>(target);
+  event.shell = shell;
+  return event;
+}
+
+GameEvent GameEvent::playerEliminated(int seat, int target) noexcept {
+  GameEvent event{GameEventType::PLAYER_ELIMINATED};
+  event.seat = static_cast<uint8_t>(seat);
+  event.target = static_cast<uint8_t>(target);
+  return event;
+}
+
+GameEvent GameEvent::itemUsed(int seat, ItemKind item, ShellType shell,
+                              bool hidden) noexcept {
+  GameEvent event{GameEventType::ITEM_USED};
+  event.seat = static_cast<uint8_t>(seat);
+  event.target = static_cast<uint8_t>(1 - seat);
+  event.item = item;
+  event.shell = shell;
+  event.hidden = hidden;
+  return event;
+}
+
+GameEvent GameEvent::itemUnavailable(int seat, ItemKind item) noexcept {
+  GameEvent event{GameEventType::ITEM_UNAVAILABLE};
+  event.seat = static_cast<uint8_t>(seat);
+  event.item = item;
+  return event;
+}
+
+GameEvent GameEvent::roundWon(int seat) noexcept {
+  GameEvent event{GameEventType::ROUND_WON};
+  event.seat = static_cast<uint8_t>(seat);
+  return event;
+}
+
+GameEvent GameEvent::gameWon(int seat) noexcept {
+  GameEvent event{GameEventType::GAME_WON};
+  event.seat = static_cast<uint8_t>(seat);
+  return event;
+}
+
+GameEvent GameEvent::actionChosen(int seat, Action action, int depth,
+                                  float value) noexcept {
+  GameEvent event{GameEventType::ACTION_CHOSEN};
+  event.seat = static_cast<uint8_t>(seat);
+  event.action = action;
+  event.depth = static_cast<uint8_t>(depth);
+  event.value = value;
+  return event;
+}
+
+void NullEventSink::onEvent(const GameEvent & /*event*/,
+                            const Game & /*game*/) {}
+
+NullEventSink &NullEventSink::instance() noexcept {
+  static NullEventSink sink;
+  return sink;
+}
+
+void ConsoleEventSink::onEvent(const GameEvent &event, const Game &game) {
+  switch (event.type) {
+  case GameEventType::ITEM_RECEIVED:
+    std::cout << nameOf(game, event.seat)
+              << " received item: " << Item::forKind(event.item).getName()
+              << "\n";
+    break;
+  case GameEventType::MAGAZINE_EMPTY:
+    std::cout << "\nShotgun is empty. Reloading...\n";
+    break;
+  case GameEventType::SHOT_FIRED: {
+    const bool self = event.seat == event.target;
+    if (self)
+      std::cout << nameOf(game, event.seat) << " shoots themself.\n";
+    else
+      std::cout << nameOf(game, event.seat) << " shoots "
+                << nameOf(game, event.target) << "\n";
+
+    if (event.shell == ShellType::LIVE_SHELL)
+      std::cout << "The shell was live. " << nameOf(game, event.target)
+                << " lost health.\n";
+    else if (self)
+      std::cout << "The shell was blank. An extra turn was gained.\n";
+    else
+      std::cout << "The shell was blank.\n";
+    break;
+  }
+  case GameEventType::PLAYER_ELIMINATED:
+    std::cout << nameOf(game, event.target) << " has been eliminated!\n";
+    break;
+  case GameEventType::ITEM_USED:
+    printItemUsed(event, game);
+    break;
+  case GameEventType::ITEM_UNAVAILABLE:
+    printItemUnavailable(event, game);
+    break;
+  case GameEventType::ROUND_WON:
+    Game::printDivider(ROUND_DIVIDER_WIDTH);
+    std::cout << nameOf(game, event.seat) << " wins the round!\n";
+    break;
+  case GameEventType::SHELLS_LOADED:
+  case GameEventType::GAME_WON:
+    // Shown by Game::printShells() and Game::showGameOver().
+    break;
+  case GameEventType::ACTION_CHOSEN:
+    // The events the action causes narrate it.
+    break;
+  }
+}
+
+ConsoleEventSink &ConsoleEventSink::instance() noexcept {
+  static ConsoleEventSink sink;
+  return sink;
+}
+
+BinaryEventSink::BinaryEventSink(std::ostream &stream) noexcept
+    : out(stream) {}
+
+void BinaryEventSink::onEvent(const GameEvent &event, const Game & /*game*/) {
+  uint8_t record[RECORD_SIZE];
+  encode(event, record);
+  out.write(reinterpret_cast<const char *>(record),
+            static_cast<std::streamsize>(RECORD_SIZE));
+}
+
+void BinaryEventSink::encode(const GameEvent &event,
+                             uint8_t *record) noexcept {
+  record[0] = static_cast<uint8_t>(event.type);
+  record[1] = event.seat;
+  record[2] = event.target;
+  record[3] = static_cast<uint8_t>(event.item);
+  record[4] = static_cast<uint8_t>(event.shell);
+  record[5] = event.live;
+  record[6] = event.blank;
+  record[7] = event.hidden ? 1 : 0;
+  record[8] = static_cast<uint8_t>(event.action);
+  record[9] = event.depth;
+  record[10] = static_cast<uint8_t>(event.shells);
+  record[11] = static_cast<uint8_t>(event.shells >> 8);
+  uint32_t valueBits;
+  std::memcpy(&valueBits, &event.value, sizeof valueBits);
+  for (int byte = 0; byte < 4; ++byte)
+    record[12 + byte] = static_cast<uint8_t>(valueBits >> (8 * byte));
+}
+
+GameEvent BinaryEventSink::decode(const uint8_t *record) {
+  if (record[0] > static_cast<uint8_t>(GameEventType::ACTION_CHOSEN) ||
+      record[1] > 1 || record[2] > 1 || record[3] >= ITEM_KIND_COUNT ||
+      record[4] > 1 || record[7] > 1 ||
+      record[8] > static_cast<uint8_t>(Action::USE_HANDSAW)) {
+    throw InvalidGameArgumentException("Malformed game event record.");
+  }
+
+  GameEvent event{static_cast<GameEventType>(record[0])};
+  event.seat = record[1];
+  event.target = record[2];
+  event.item = static_cast<ItemKind>(record[3]);
+  event.shell = static_cast<ShellType>(record[4]);
+  event.live = record[5];
+  event.blank = record[6];
+  event.hidden = record[7] != 0;
+  event.action = static_cast<Action>(record[8]);
+  event.depth = record[9];
+  event.shells = static_cast<uint16_t>(record[10] | (record[11] << 8));
+  uint32_t valueBits = 0;
+  for (int byte = 0; byte < 4; ++byte)
+    valueBits |= static_cast<uint32_t>(record[12 + byte]) << (8 * byte);
+  std::memcpy(&event.value, &valueBits, sizeof valueBits);
+  return event;
+}
\ No newline at end of file
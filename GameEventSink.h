@@ -0,0 +1,257 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_GAMEEVENTSINK_H
+#define BUCKSHOT_ROULETTE_BOT_GAMEEVENTSINK_H
+
+#include "Items/Item.h"
+#include "Player.h"
+#include "Shotgun.h"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+class Game;
+
+/**
+ * @enum class GameEventType
+ * @brief Everything the rules report while a game is played.
+ */
+enum class GameEventType : uint8_t {
+  ITEM_RECEIVED = 0,     ///< `seat` was dealt `item`.
+  SHELLS_LOADED = 1,     ///< The shotgun holds `shells`: `live`, `blank`.
+  MAGAZINE_EMPTY = 2,    ///< The shotgun ran dry and is about to reload.
+  SHOT_FIRED = 3,        ///< `seat` shot `target` with `shell`.
+  PLAYER_ELIMINATED = 4, ///< A shot from `seat` took `target` to 0 health.
+  ITEM_USED = 5,         ///< `seat` used `item` (Beer/Glass: on `shell`).
+  ITEM_UNAVAILABLE = 6,  ///< `seat` chose `item` but could not use it.
+  ROUND_WON = 7,         ///< `seat` won the round.
+  GAME_WON = 8,          ///< `seat` won the match.
+  ACTION_CHOSEN = 9      ///< `seat` chose `action` (bots: `depth`, `value`).
+};
+
+/**
+ * @struct GameEvent
+ * @brief One typed, allocation-free record of something the rules did.
+ *
+ * Players are identified by seat (0 for player one, 1 for player two); a
+ * sink that needs names reads them from the Game passed alongside.
+ */
+struct GameEvent {
+  GameEventType type;                ///< What happened.
+  uint8_t seat = 0;                  ///< The acting player.
+  uint8_t target = 0;                ///< The affected player, for shots.
+  ItemKind item = ItemKind::BEER;    ///< The item involved, if any.
+  ShellType shell = ShellType::BLANK_SHELL; ///< The shell involved, if any.
+  uint8_t live = 0;                  ///< Live shells loaded.
+  uint8_t blank = 0;                 ///< Blank shells loaded.
+  bool hidden = false;               ///< `shell` is known only to `seat`.
+  Action action = Action::SHOOT_SELF; ///< The action chosen.
+  uint8_t depth = 0;                 ///< Depth searched; 0 if not searched.
+  uint16_t shells = 0;               ///< Loaded shells, as Shotgun bits.
+  float value = 0.0f;                ///< Chooser's value of the action.
+
+  /**
+   * @brief An item was dealt.
+   * @param seat Receiving player.
+   * @param item The item.
+   * @return The event.
+   */
+  [[nodiscard]] static GameEvent itemReceived(int seat, ItemKind item) noexcept;
+
+  /**
+   * @brief The shotgun was loaded.
+   * @param live Live shells.
+   * @param blank Blank shells.
+   * @param shells The magazine in firing order (Shotgun::getShellBits()).
+   * @return The event.
+   */
+  [[nodiscard]] static GameEvent shellsLoaded(int live, int blank,
+                                              uint16_t shells) noexcept;
+
+  /**
+   * @brief The shotgun is empty and will be reloaded.
+   * @return The event.
+   */
+  [[nodiscard]] static GameEvent magazineEmpty() noexcept;
+
+  /**
+   * @brief A shot was fired.
+   * @param seat Shooting player.
+   * @param target Player shot (may equal seat).
+   * @param shell The shell fired.
+   * @return The event.
+   */
+  [[nodiscard]] static GameEvent shotFired(int seat, int target,
+                                           ShellType shell) noexcept;
+
+  /**
+   * @brief A shot eliminated a player.
+   * @param seat Shooting player.
+   * @param target Eliminated player.
+   * @return The event.
+   */
+  [[nodiscard]] static GameEvent playerEliminated(int seat,
+                                                  int target) noexcept;
+
+  /**
+   * @brief An item was used.
+   * @param seat Acting player.
+   * @param item The item.
+   * @param shell Shell ejected (Beer) or revealed (Magnifying Glass).
+   * @param hidden True if only the acting player may see `shell`.
+   * @return The event.
+   */
+  [[nodiscard]] static GameEvent
+  itemUsed(int seat, ItemKind item, ShellType shell = ShellType::BLANK_SHELL,
+           bool hidden = false) noexcept;
+
+  /**
+   * @brief A chosen item could not be used.
+   * @param seat Acting player.
+   * @param item The item.
+   * @return The event.
+   */
+  [[nodiscard]] static GameEvent itemUnavailable(int seat,
+                                                 ItemKind item) noexcept;
+
+  /**
+   * @brief A round was won.
+   * @param seat Winning player.
+   * @return The event.
+   */
+  [[nodiscard]] static GameEvent roundWon(int seat) noexcept;
+
+  /**
+   * @brief The match was won.
+   * @param seat Winning player.
+   * @return The event.
+   */
+  [[nodiscard]] static GameEvent gameWon(int seat) noexcept;
+
+  /**
+   * @brief A player chose their next action.
+   * @param seat Choosing player.
+   * @param action The action.
+   * @param depth Depth the choice was searched to; 0 if not searched.
+   * @param value Chooser's value of the action; NaN if unknown.
+   * @return The event.
+   */
+  [[nodiscard]] static GameEvent actionChosen(int seat, Action action,
+                                              int depth, float value) noexcept;
+};
+
+/**
+ * @class GameEventSink
+ * @brief Receives the events a Game emits.
+ *
+ * Rules code only builds GameEvent records; all formatting happens in the
+ * sink, so a game with a NullEventSink does no output work at all.
+ */
+class GameEventSink {
+public:
+  /**
+   * @brief Virtual destructor for proper polymorphic destruction.
+   */
+  virtual ~GameEventSink() = default;
+
+  /**
+   * @brief Handles one event.
+   * @param event The event.
+   * @param game The game that emitted it, after the event took effect.
+   */
+  virtual void onEvent(const GameEvent &event, const Game &game) = 0;
+};
+
+/**
+ * @class NullEventSink
+ * @brief Discards every event.
+ */
+class NullEventSink final : public GameEventSink {
+public:
+  /**
+   * @brief Does nothing.
+   * @param event Ignored.
+   * @param game Ignored.
+   */
+  void onEvent(const GameEvent &event, const Game &game) override;
+
+  /**
+   * @brief Shared instance; the sink is stateless.
+   * @return The instance.
+   */
+  [[nodiscard]] static NullEventSink &instance() noexcept;
+};
+
+/**
+ * @class ConsoleEventSink
+ * @brief Narrates events on std::cout for people watching the game.
+ *
+ * Shell loads and the match result are left to Game's own display hooks
+ * (printShells() and showGameOver()), so they are not repeated here, and
+ * chosen actions are narrated by the events they cause.  Shells marked
+ * hidden are not printed.
+ */
+class ConsoleEventSink final : public GameEventSink {
+public:
+  /**
+   * @brief Prints the event as a line of narration.
+   * @param event The event.
+   * @param game The game, for player names.
+   */
+  void onEvent(const GameEvent &event, const Game &game) override;
+
+  /**
+   * @brief Shared instance; the sink is stateless.
+   * @return The instance.
+   */
+  [[nodiscard]] static ConsoleEventSink &instance() noexcept;
+};
+
+/**
+ * @class BinaryEventSink
+ * @brief Appends each event to a stream as a fixed-size record.
+ *
+ * Each record is RECORD_SIZE bytes, multi-byte fields little-endian:
+ *
+ *     0 type    1 seat    2 target   3 item    4 shell    5 live    6 blank
+ *     7 hidden  8 action  9 depth    10-11 shells         12-15 value (float)
+ *
+ * The stream is not locked; give each concurrently running game its own sink
+ * and stream.
+ */
+class BinaryEventSink final : public GameEventSink {
+public:
+  // Bytes written per event.
+  static constexpr size_t RECORD_SIZE = 16;
+
+  /**
+   * @brief Creates a sink writing to a stream.
+   * @param out Destination (non-owning); must outlive the sink.
+   */
+  explicit BinaryEventSink(std::ostream &out) noexcept;
+
+  /**
+   * @brief Writes the event's record.
+   * @param event The event.
+   * @param game Ignored.
+   */
+  void onEvent(const GameEvent &event, const Game &game) override;
+
+  /**
+   * @brief Packs an event into a record.
+   * @param event The event.
+   * @param record Receives RECORD_SIZE bytes.
+   */
+  static void encode(const GameEvent &event, uint8_t *record) noexcept;
+
+  /**
+   * @brief Unpacks a record written by encode().
+   * @param record RECORD_SIZE bytes.
+   * @return The event.
+   * @throws InvalidGameArgumentException If the record is malformed.
+   */
+  [[nodiscard]] static GameEvent decode(const uint8_t *record);
+
+private:
+  std::ostream &out; ///< Destination stream.
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_GAMEEVENTSINK_H
\ No newline at end of file
@@ -97,7 +97,7 @@ bool HumanPlayer::isValidAction(Action action) const {
     return true;
 
   case Action::SMOKE_CIGARETTE:
-    if (!hasItem("Cigarette")) {
+    if (!hasItem(ItemKind::CIGARETTE)) {
       std::cout << "You do not have any Cigarette to smoke. Please choose a "
                 << "different action."
                 << "\n";
@@ -106,7 +106,7 @@ bool HumanPlayer::isValidAction(Action action) const {
     return true;
 
   case Action::USE_HANDCUFFS:
-    if (!hasItem("Handcuffs")) {
+    if (!hasItem(ItemKind::HANDCUFFS)) {
       std::cout << "You do not have any Handcuffs. Please choose a different "
                 << "action."
                 << "\n";
@@ -127,7 +127,7 @@ bool HumanPlayer::isValidAction(Action action) const {
     return true;
 
   case Action::USE_MAGNIFYING_GLASS:
-    if (!hasItem("Magnifying Glass")) {
+    if (!hasItem(ItemKind::MAGNIFYING_GLASS)) {
       std::cout << "You do not have a Magnifying Glass. Please choose a "
                 << "different action."
                 << "\n";
@@ -136,7 +136,7 @@ bool HumanPlayer::isValidAction(Action action) const {
     return true;
 
   case Action::DRINK_BEER:
-    if (!hasItem("Beer")) {
+    if (!hasItem(ItemKind::BEER)) {
       std::cout << "You do not have any Beer. Please choose a different action."
                 << "\n";
       return false;
@@ -144,7 +144,7 @@ bool HumanPlayer::isValidAction(Action action) const {
     return true;
 
   case Action::USE_HANDSAW:
-    if (!hasItem("Handsaw")) {
+    if (!hasItem(ItemKind::HANDSAW)) {
       std::cout
           << "You do not have a Handsaw. Please choose a different action."
           << "\n";
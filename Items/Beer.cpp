@@ -1,14 +1,10 @@
 #include "Beer.h"
 #include "Player.h"
-#include <iostream>
 
 void Beer::use(Player *user, Player * /*target*/, Shotgun *shotgun) {
   if (!user || !shotgun)
     return;
 
-  std::cout << user->getName()
-            << " uses Beer to eject the current shell from the shotgun."
-            << "\n";
   shotgun->rackShell();
 }
 
@@ -17,6 +13,8 @@ std::string_view Beer::getName() const {
   return name;
 }
 
+ItemKind Beer::getKind() const noexcept { return ItemKind::BEER; }
+
 std::unique_ptr<Item> Beer::clone() const {
   return std::make_unique<Beer>(*this);
 }
\ No newline at end of file
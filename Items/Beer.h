@@ -26,6 +26,12 @@ public:
    */
   [[nodiscard]] std::string_view getName() const override;
 
+  /**
+   * @brief Retrieves the item's kind.
+   * @return ItemKind::BEER.
+   */
+  [[nodiscard]] ItemKind getKind() const noexcept override;
+
   /**
    * @brief Creates a deep copy of this beer.
    * @return Unique pointer to a new beer instance.
@@ -1,13 +1,9 @@
 #include "Cigarette.h"
 #include "Player.h"
-#include <iostream>
 
 void Cigarette::use(Player *user, Player * /*target*/, Shotgun * /*shotgun*/) {
-  if (user) {
-    std::cout << user->getName() << " uses Cigarette and restores 1 HP."
-              << "\n";
+  if (user)
     user->smokeCigarette();
-  }
 }
 
 std::string_view Cigarette::getName() const {
@@ -15,6 +11,8 @@ std::string_view Cigarette::getName() const {
   return name;
 }
 
+ItemKind Cigarette::getKind() const noexcept { return ItemKind::CIGARETTE; }
+
 std::unique_ptr<Item> Cigarette::clone() const {
   return std::make_unique<Cigarette>(*this);
 }
\ No newline at end of file
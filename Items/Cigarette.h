@@ -26,6 +26,12 @@ public:
    */
   [[nodiscard]] std::string_view getName() const override;
 
+  /**
+   * @brief Retrieves the item's kind.
+   * @return ItemKind::CIGARETTE.
+   */
+  [[nodiscard]] ItemKind getKind() const noexcept override;
+
   /**
    * @brief Creates a deep copy of this cigarette.
    * @return Unique pointer to a new cigarette instance.
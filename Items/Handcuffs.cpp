@@ -1,21 +1,12 @@
 #include "Handcuffs.h"
 #include "Player.h"
-#include <iostream>
 
 void Handcuffs::use(Player *user, Player *target, Shotgun * /*shotgun*/) {
   if (!user || !target)
     return;
 
-  if (user->hasUsedHandcuffsThisTurn()) {
-    std::cout << user->getName() << " has already applied handcuffs this turn."
-              << "\n";
-  } else if (target->areHandcuffsApplied()) {
-    std::cout << target->getName() << " is already handcuffed."
-              << "\n";
-  } else {
-    std::cout << user->getName() << " uses Handcuffs on " << target->getName()
-              << ", causing them to miss their next turn."
-              << "\n";
+  // One application per turn, and never on someone already cuffed.
+  if (!user->hasUsedHandcuffsThisTurn() && !target->areHandcuffsApplied()) {
     target->applyHandcuffs();
     user->useHandcuffsThisTurn();
   }
@@ -26,6 +17,8 @@ std::string_view Handcuffs::getName() const {
   return name;
 }
 
+ItemKind Handcuffs::getKind() const noexcept { return ItemKind::HANDCUFFS; }
+
 std::unique_ptr<Item> Handcuffs::clone() const {
   return std::make_unique<Handcuffs>(*this);
 }
\ No newline at end of file
@@ -1,15 +1,10 @@
 #include "Handsaw.h"
 #include "Player.h"
-#include <iostream>
 
 void Handsaw::use(Player *user, Player * /*target*/, Shotgun *shotgun) {
   if (!user || !shotgun)
     return;
 
-  std::cout << user->getName()
-            << " uses a Handsaw to modify the shotgun, doubling the damage of "
-               "the next live round."
-            << "\n";
   shotgun->useHandsaw();
 }
 
@@ -18,6 +13,8 @@ std::string_view Handsaw::getName() const {
   return name;
 }
 
+ItemKind Handsaw::getKind() const noexcept { return ItemKind::HANDSAW; }
+
 std::unique_ptr<Item> Handsaw::clone() const {
   return std::make_unique<Handsaw>(*this);
 }
\ No newline at end of file
@@ -26,6 +26,12 @@ public:
    */
   [[nodiscard]] std::string_view getName() const override;
 
+  /**
+   * @brief Retrieves the item's kind.
+   * @return ItemKind::HANDSAW.
+   */
+  [[nodiscard]] ItemKind getKind() const noexcept override;
+
   /**
    * @brief Creates a deep copy of this handsaw item.
    * @return Unique pointer to a new handsaw instance.
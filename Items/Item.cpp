@@ -19,4 +19,26 @@ std::unique_ptr<Item> Item::createByName(std::string_view name) {
     return std::make_unique<MagnifyingGlass>();
 
   return nullptr;
+}
+
+Item &Item::forKind(ItemKind kind) noexcept {
+  static Beer beer;
+  static Cigarette cigarette;
+  static Handcuffs handcuffs;
+  static Handsaw handsaw;
+  static MagnifyingGlass magnifyingGlass;
+  static Item *const instances[ITEM_KIND_COUNT] = {
+      &beer, &cigarette, &handcuffs, &handsaw, &magnifyingGlass};
+  return *instances[static_cast<int>(kind)];
+}
+
+bool Item::kindFromName(std::string_view name, ItemKind &kind) noexcept {
+  for (int index = 0; index < ITEM_KIND_COUNT; ++index) {
+    const auto candidate = static_cast<ItemKind>(index);
+    if (forKind(candidate).getName() == name) {
+      kind = candidate;
+      return true;
+    }
+  }
+  return false;
 }
\ No newline at end of file
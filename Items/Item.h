@@ -8,10 +8,27 @@
 
 class Player;
 
+/**
+ * @enum class ItemKind
+ * @brief Dense identifiers for each item type, usable as array indices.
+ */
+enum class ItemKind : int {
+  BEER = 0,
+  CIGARETTE = 1,
+  HANDCUFFS = 2,
+  HANDSAW = 3,
+  MAGNIFYING_GLASS = 4
+};
+
+// Number of distinct item kinds.
+static constexpr int ITEM_KIND_COUNT = 5;
+
 /**
  * @brief Base class for all game items.
  *
- * Defines the interface for item usage and retrieval.
+ * Defines the interface for item usage and retrieval.  Items carry no state
+ * of their own, so inventories store only an ItemKind and dispatch through
+ * the shared instance returned by forKind().
  */
 class Item {
 public:
@@ -35,6 +52,12 @@ public:
    */
   [[nodiscard]] virtual std::string_view getName() const = 0;
 
+  /**
+   * @brief Retrieves the item's kind.
+   * @return The item kind.
+   */
+  [[nodiscard]] virtual ItemKind getKind() const noexcept = 0;
+
   /**
    * @brief Creates a deep copy of the item.
    * @return Unique pointer to a new item instance.
@@ -49,6 +72,22 @@ public:
    */
   [[nodiscard]] static std::unique_ptr<Item>
   createByName(std::string_view name);
+
+  /**
+   * @brief Gets the shared instance of an item kind.
+   * @param kind The item kind.
+   * @return The stateless item implementing that kind.
+   */
+  [[nodiscard]] static Item &forKind(ItemKind kind) noexcept;
+
+  /**
+   * @brief Looks up the kind an item name refers to.
+   * @param name The item name, as returned by getName().
+   * @param kind Receives the kind if the name is known.
+   * @return True if the name refers to an item.
+   */
+  [[nodiscard]] static bool kindFromName(std::string_view name,
+                                         ItemKind &kind) noexcept;
 };
 
 #endif // BUCKSHOT_ROULETTE_BOT_ITEM_H
\ No newline at end of file
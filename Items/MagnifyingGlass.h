@@ -29,6 +29,12 @@ public:
    */
   [[nodiscard]] std::string_view getName() const override;
 
+  /**
+   * @brief Retrieves the item's kind.
+   * @return ItemKind::MAGNIFYING_GLASS.
+   */
+  [[nodiscard]] ItemKind getKind() const noexcept override;
+
   /**
    * @brief Creates a deep copy of this magnifying glass item.
    * @return Unique pointer to a new magnifying glass instance.
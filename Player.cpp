@@ -1,44 +1,48 @@
 #include "Player.h"
 #include "Exceptions.h"
 #include <algorithm>
+#include <iterator>
 #include <utility>
 
-int Player::maxHealth = 0;
+const char *actionName(Action action) noexcept {
+  switch (action) {
+  case Action::SHOOT_SELF: return "shoot self";
+  case Action::SHOOT_OPPONENT: return "shoot opponent";
+  case Action::SMOKE_CIGARETTE: return "cigarette";
+  case Action::USE_HANDCUFFS: return "handcuffs";
+  case Action::USE_MAGNIFYING_GLASS: return "magnifying glass";
+  case Action::DRINK_BEER: return "beer";
+  case Action::USE_HANDSAW: return "handsaw";
+  }
+  return "unknown";
+}
 
 Player::Player(std::string playerName, int playerHealth)
-    : name(std::move(playerName)), health(playerHealth), opponent(nullptr) {
+    : name(std::move(playerName)), health(playerHealth),
+      maxHealth(playerHealth), opponent(nullptr) {
   if (health <= 0) {
     throw InvalidGameArgumentException(
         "Player health must be a positive value.");
   }
-  if (maxHealth == 0) {
-    maxHealth = health;
-  }
 }
 
 Player::Player(std::string playerName, int playerHealth, Player *opp)
-    : name(std::move(playerName)), health(playerHealth), opponent(opp) {
+    : name(std::move(playerName)), health(playerHealth),
+      maxHealth(playerHealth), opponent(opp) {
   if (health <= 0) {
     throw InvalidGameArgumentException(
         "Player health must be a positive value.");
   }
-  if (maxHealth == 0) {
-    maxHealth = health;
-  }
 }
 
 Player::Player(const Player &other)
-    : name(other.name), health(other.health), opponent(other.opponent),
+    : name(other.name), health(other.health), maxHealth(other.maxHealth),
+      opponent(other.opponent),
       handcuffsApplied(other.handcuffsApplied),
       nextShellRevealed(other.nextShellRevealed),
       knownNextShell(other.knownNextShell),
       handcuffsUsedThisTurn(other.handcuffsUsedThisTurn) {
-
-  // Deep copy items
-  items.reserve(other.items.size());
-  for (const auto &item : other.items)
-    if (item)
-      items.push_back(Item::createByName(item->getName()));
+  copyItemsFrom(other);
 }
 
 Player &Player::operator=(const Player &other) {
@@ -48,29 +52,24 @@ Player &Player::operator=(const Player &other) {
 
   name = other.name;
   health = other.health;
+  maxHealth = other.maxHealth;
   opponent = other.opponent;
   handcuffsApplied = other.handcuffsApplied;
   nextShellRevealed = other.nextShellRevealed;
   knownNextShell = other.knownNextShell;
   handcuffsUsedThisTurn = other.handcuffsUsedThisTurn;
-
-  // Clear and deep copy items
-  items.clear();
-  items.reserve(other.items.size());
-  for (const auto &item : other.items)
-    if (item)
-      items.push_back(Item::createByName(item->getName()));
+  copyItemsFrom(other);
 
   return *this;
 }
 
 Player::Player(Player &&other) noexcept
     : name(std::move(other.name)), health(other.health),
-      opponent(other.opponent), items(std::move(other.items)),
-      handcuffsApplied(other.handcuffsApplied),
+      maxHealth(other.maxHealth), opponent(other.opponent), handcuffsApplied(other.handcuffsApplied),
       nextShellRevealed(other.nextShellRevealed),
       knownNextShell(other.knownNextShell),
       handcuffsUsedThisTurn(other.handcuffsUsedThisTurn) {
+  copyItemsFrom(other);
 
   // Reset other's state
   other.health = 0;
@@ -78,6 +77,8 @@ Player::Player(Player &&other) noexcept
   other.handcuffsApplied = false;
   other.nextShellRevealed = false;
   other.handcuffsUsedThisTurn = false;
+  other.itemCount = 0;
+  std::fill(std::begin(other.kindCounts), std::end(other.kindCounts), 0);
 }
 
 Player &Player::operator=(Player &&other) noexcept {
@@ -87,8 +88,9 @@ Player &Player::operator=(Player &&other) noexcept {
 
   name = std::move(other.name);
   health = other.health;
+  maxHealth = other.maxHealth;
   opponent = other.opponent;
-  items = std::move(other.items);
+  copyItemsFrom(other);
   handcuffsApplied = other.handcuffsApplied;
   nextShellRevealed = other.nextShellRevealed;
   knownNextShell = other.knownNextShell;
@@ -100,6 +102,8 @@ Player &Player::operator=(Player &&other) noexcept {
   other.handcuffsApplied = false;
   other.nextShellRevealed = false;
   other.handcuffsUsedThisTurn = false;
+  other.itemCount = 0;
+  std::fill(std::begin(other.kindCounts), std::end(other.kindCounts), 0);
 
   return *this;
 }
@@ -124,17 +128,33 @@ void Player::smokeCigarette() noexcept {
   }
 }
 
-void Player::resetMaxHealth(int newHealth) noexcept { maxHealth = newHealth; }
+void Player::setMaxHealth(int newMaxHealth) {
+  if (newMaxHealth <= 0) {
+    throw InvalidGameArgumentException(
+        "Player max health must be a positive value.");
+  }
+  maxHealth = newMaxHealth;
+}
 
 void Player::resetHealth() noexcept { health = maxHealth; }
 
+void Player::resetForNewGame() noexcept {
+  health = maxHealth;
+  itemCount = 0;
+  for (auto &count : kindCounts)
+    count = 0;
+  handcuffsApplied = false;
+  nextShellRevealed = false;
+  handcuffsUsedThisTurn = false;
+}
+
 bool Player::isAlive() const noexcept { return health > 0; }
 
 std::string_view Player::getName() const noexcept { return name; }
 
 int Player::getHealth() const noexcept { return health; }
 
-int Player::getMaxHealth() noexcept { return maxHealth; }
+int Player::getMaxHealth() const noexcept { return maxHealth; }
 
 void Player::applyHandcuffs() noexcept { handcuffsApplied = true; }
 
@@ -159,92 +179,91 @@ bool Player::addItem(std::unique_ptr<Item> newItem) {
   if (!newItem) {
     throw InvalidItemException("Cannot add a null item to inventory.");
   }
-  if (items.size() >= MAX_ITEMS) {
+  return addItem(newItem->getKind());
+}
+
+bool Player::addItem(ItemKind kind) noexcept {
+  if (itemCount >= MAX_ITEMS) {
     return false;
   }
-  items.push_back(std::move(newItem));
+  items[itemCount++] = kind;
+  ++kindCounts[static_cast<int>(kind)];
   return true;
 }
 
-bool Player::useItem(int index) {
-  if (index < 0 || index >= static_cast<int>(items.size())) {
-    return false;
-  }
+void Player::copyItemsFrom(const Player &other) noexcept {
+  std::copy(std::begin(other.items), std::end(other.items), std::begin(items));
+  std::copy(std::begin(other.kindCounts), std::end(other.kindCounts),
+            std::begin(kindCounts));
+  itemCount = other.itemCount;
+}
+
+void Player::removeSlot(int index) noexcept {
+  --kindCounts[static_cast<int>(items[index])];
+  std::copy(items + index + 1, items + itemCount, items + index);
+  --itemCount;
+}
 
-  if (items[index]) {
-    items[index]->use(this, opponent);
-    items.erase(items.begin() + index);
-    return true;
+int Player::findSlot(ItemKind kind) const noexcept {
+  if (!hasItem(kind)) {
+    return -1;
   }
-  return false;
+  return static_cast<int>(std::find(items, items + itemCount, kind) - items);
 }
 
+bool Player::useItem(int index) { return useItem(index, nullptr); }
+
 bool Player::useItem(int index, Shotgun *shotgun) {
-  if (index < 0 || index >= static_cast<int>(items.size())) {
+  if (index < 0 || index >= itemCount) {
     return false;
   }
 
-  if (items[index]) {
-    items[index]->use(this, opponent, shotgun);
-    items.erase(items.begin() + index);
-    return true;
-  }
-  return false;
+  Item::forKind(items[index]).use(this, opponent, shotgun);
+  removeSlot(index);
+  return true;
 }
 
-int Player::getItemCount() const noexcept {
-  return static_cast<int>(items.size());
+int Player::getItemCount() const noexcept { return itemCount; }
+
+bool Player::useItem(ItemKind kind, Shotgun *shotgun) {
+  return useItem(findSlot(kind), shotgun);
 }
 
-bool Player::useItemByName(std::string_view itemName, Shotgun *shotgun) {
-  auto it = std::find_if(items.begin(), items.end(),
-                         [&itemName](const std::unique_ptr<Item> &item) {
-                           return item && item->getName() == itemName;
-                         });
-
-  if (it != items.end()) {
-    size_t index = std::distance(items.begin(), it);
-    return shotgun ? useItem(static_cast<int>(index), shotgun)
-                   : useItem(static_cast<int>(index));
+bool Player::removeItem(ItemKind kind) noexcept {
+  const int index = findSlot(kind);
+  if (index < 0) {
+    return false;
   }
-  return false;
+  removeSlot(index);
+  return true;
+}
+
+bool Player::useItemByName(std::string_view itemName, Shotgun *shotgun) {
+  ItemKind kind;
+  return Item::kindFromName(itemName, kind) && useItem(kind, shotgun);
 }
 
 bool Player::removeItemByName(std::string_view itemName) {
-  auto it = std::find_if(items.begin(), items.end(),
-                         [&itemName](const std::unique_ptr<Item> &item) {
-                           return item && item->getName() == itemName;
-                         });
-
-  if (it != items.end()) {
-    items.erase(it);
-    return true;
-  }
-  return false;
+  ItemKind kind;
+  return Item::kindFromName(itemName, kind) && removeItem(kind);
 }
 
 bool Player::hasItem(std::string_view itemName) const {
-  return std::any_of(items.begin(), items.end(),
-                     [&itemName](const std::unique_ptr<Item> &item) {
-                       return item && item->getName() == itemName;
-                     });
+  ItemKind kind;
+  return Item::kindFromName(itemName, kind) && hasItem(kind);
 }
 
 int Player::countItem(std::string_view itemName) const {
-  return static_cast<int>(
-      std::count_if(items.begin(), items.end(),
-                    [&itemName](const std::unique_ptr<Item> &item) {
-                      return item && item->getName() == itemName;
-                    }));
+  ItemKind kind;
+  return Item::kindFromName(itemName, kind) ? countItem(kind) : 0;
 }
 
 std::vector<Item *> Player::getItemsView() const {
   std::vector<Item *> itemPointers;
-  itemPointers.reserve(items.size());
+  itemPointers.reserve(static_cast<size_t>(itemCount));
 
-  for (const auto &item : items)
-    if (item)
-      itemPointers.push_back(item.get());
+  for (int i = 0; i < itemCount; i++)
+    itemPointers.push_back(&Item::forKind(items[i]));
 
   return itemPointers;
 }
@@ -252,13 +271,12 @@ std::vector<Item *> Player::getItemsView() const {
 void Player::printItems() const {
   std::cout << getName() << "'s items: ";
 
-  if (items.empty()) {
+  if (itemCount == 0) {
     std::cout << "None";
   } else {
-    for (size_t i = 0; i < items.size(); i++) {
-      if (items[i]) {
-        std::cout << items[i]->getName() << (i < items.size() - 1 ? ", " : "");
-      }
+    for (int i = 0; i < itemCount; i++) {
+      std::cout << Item::forKind(items[i]).getName()
+                << (i < itemCount - 1 ? ", " : "");
     }
   }
   std::cout << "\n";
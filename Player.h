@@ -3,6 +3,7 @@
 
 #include "Items/Item.h"
 #include "Shotgun.h"
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -24,20 +25,37 @@ enum class Action : int {
   USE_HANDSAW = 6           ///< Doubles live round damage.
 };
 
+// Number of distinct actions.
+static constexpr int ACTION_COUNT = 7;
+
+/**
+ * @brief Short name of an action for reports.
+ * @param action The action.
+ * @return Its name.
+ */
+[[nodiscard]] const char *actionName(Action action) noexcept;
+
 // Maximum number of items a player can hold in their inventory at once.
 static constexpr int MAX_ITEMS = 8;
 
 /**
  * @class Player
  * @brief Represents a player with health, inventory, and game actions.
+ *
+ * The inventory is a fixed array of item kinds in pickup order plus a count
+ * per kind, so item queries are array reads and copying a player never
+ * allocates.  Using an item dispatches to its shared Item::forKind()
+ * instance.
  */
 class Player {
 protected:
   std::string name;     ///< Player's name.
   int health;           ///< Current health.
-  static int maxHealth; ///< Maximum player health.
+  int maxHealth;        ///< Health restored at the start of each round.
   Player *opponent;     ///< Pointer to opponent (non-owning).
-  std::vector<std::unique_ptr<Item>> items; ///< Inventory (owned).
+  ItemKind items[MAX_ITEMS] = {};           ///< Held items, in pickup order.
+  int itemCount = 0;                        ///< Occupied slots in `items`.
+  uint8_t kindCounts[ITEM_KIND_COUNT] = {}; ///< Held items per kind.
   bool handcuffsApplied = false;            ///< Whether handcuffs are applied.
   bool nextShellRevealed =
       false; ///< Indicates if the next shell has been revealed.
@@ -46,18 +64,37 @@ protected:
   bool handcuffsUsedThisTurn =
       false; ///< Tracks if handcuffs were used this turn.
 
+  /**
+   * @brief Copies another player's inventory over this one.
+   * @param other The player to copy from.
+   */
+  void copyItemsFrom(const Player &other) noexcept;
+
+  /**
+   * @brief Drops the item in a slot, keeping the rest in pickup order.
+   * @param index An occupied slot.
+   */
+  void removeSlot(int index) noexcept;
+
+  /**
+   * @brief Finds the first slot holding a kind.
+   * @param kind The item kind.
+   * @return The slot index, or -1 if none is held.
+   */
+  [[nodiscard]] int findSlot(ItemKind kind) const noexcept;
+
 public:
   /**
    * @brief Constructs a player.
    * @param name Player's name.
-   * @param health Starting health.
+   * @param health Starting health, which is also their max health.
    */
   Player(std::string name, int health);
 
   /**
    * @brief Constructs a player with an assigned opponent.
    * @param name Player's name.
-   * @param health Starting health.
+   * @param health Starting health, which is also their max health.
    * @param opponent Pointer to the opponent (non-owning).
    */
   Player(std::string name, int health, Player *opponent);
@@ -119,16 +156,28 @@ public:
   void smokeCigarette() noexcept;
 
   /**
-   * @brief Resets player health to a new value.
-   * @param newHealth The new health value.
+   * @brief Changes the player's health cap.
+   *
+   * Current health is left alone; call resetHealth() to refill it.
+   *
+   * @param newMaxHealth The new cap.
+   * @throws InvalidGameArgumentException If the cap is not positive.
    */
-  static void resetMaxHealth(int newHealth) noexcept;
+  void setMaxHealth(int newMaxHealth);
 
   /**
-   * @brief Resets player health to the default max.
+   * @brief Resets player health to their max.
    */
   void resetHealth() noexcept;
 
+  /**
+   * @brief Returns the player to the start of a new game.
+   *
+   * Health is refilled and every item, handcuff and piece of shell
+   * knowledge is dropped, so one player object can play game after game.
+   */
+  void resetForNewGame() noexcept;
+
   /**
    * @brief Checks if the player is alive.
    * @return True if health is above 0.
@@ -148,10 +197,10 @@ public:
   [[nodiscard]] int getHealth() const noexcept;
 
   /**
-   * @brief Gets the maximum possible health.
+   * @brief Gets the player's health cap.
    * @return Maximum health.
    */
-  [[nodiscard]] static int getMaxHealth() noexcept;
+  [[nodiscard]] int getMaxHealth() const noexcept;
 
   /**
    * @brief Applies handcuffs to the player.
@@ -196,9 +245,17 @@ public:
    * @brief Adds an item to the inventory.
    * @param newItem Pointer to the item (takes ownership).
    * @return True if added, false if inventory is full.
+   * @throws InvalidItemException If newItem is null.
    */
   bool addItem(std::unique_ptr<Item> newItem);
 
+  /**
+   * @brief Adds an item of the given kind to the inventory.
+   * @param kind The item kind.
+   * @return True if added, false if inventory is full.
+   */
+  bool addItem(ItemKind kind) noexcept;
+
   /**
    * @brief Uses an item by index.
    * @param index The item index.
@@ -220,6 +277,39 @@ public:
    */
   [[nodiscard]] int getItemCount() const noexcept;
 
+  /**
+   * @brief Uses the first held item of a kind.
+   * @param kind The item kind.
+   * @param shotgun Optional shotgun pointer.
+   * @return True if used.
+   */
+  bool useItem(ItemKind kind, Shotgun *shotgun = nullptr);
+
+  /**
+   * @brief Removes the first held item of a kind without using it.
+   * @param kind The item kind.
+   * @return True if removed.
+   */
+  bool removeItem(ItemKind kind) noexcept;
+
+  /**
+   * @brief Checks if the player holds an item of a kind.
+   * @param kind The item kind.
+   * @return True if at least one is held.
+   */
+  [[nodiscard]] bool hasItem(ItemKind kind) const noexcept {
+    return kindCounts[static_cast<int>(kind)] > 0;
+  }
+
+  /**
+   * @brief Returns the number of held items of a kind.
+   * @param kind The item kind.
+   * @return Number of matching items.
+   */
+  [[nodiscard]] int countItem(ItemKind kind) const noexcept {
+    return kindCounts[static_cast<int>(kind)];
+  }
+
   /**
    * @brief Uses an item by name.
    * @param itemName The item name.
@@ -252,7 +342,8 @@ public:
   /**
    * @brief Gets a copy of the player's items as raw pointers for read-only
    * operations.
-   * @return A vector of raw pointers to the items.
+   * @return A vector of pointers to the shared item instances, in pickup
+   * order.
    */
   [[nodiscard]] std::vector<Item *> getItemsView() const;
 
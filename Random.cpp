@@ -0,0 +1,39 @@
+#include "Random.h"
+
+namespace {
+/**
+ * @brief SplitMix64 finalizer; spreads nearby inputs across all 64 bits.
+ * @param value Input value.
+ * @return The mixed value.
+ */
+uint64_t mix(uint64_t value) noexcept {
+  value += 0x9E3779B97F4A7C15ull;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+  return value ^ (value >> 31);
+}
+} // namespace
+
+uint64_t Random::gameSeed(uint64_t masterSeed, uint64_t gameIndex) noexcept {
+  return mix(mix(masterSeed) ^ gameIndex);
+}
+
+Random::Engine Random::makeEngine(uint64_t seed) {
+  std::seed_seq sequence{static_cast<uint32_t>(seed),
+                         static_cast<uint32_t>(seed >> 32)};
+  return Engine(sequence);
+}
+
+uint64_t Random::randomSeed() {
+  Engine &engine = threadEngine();
+  const uint64_t high = engine();
+  return (high << 32) | engine();
+}
+
+Random::Engine &Random::threadEngine() {
+  thread_local Engine engine = [] {
+    std::random_device device;
+    return makeEngine((static_cast<uint64_t>(device()) << 32) | device());
+  }();
+  return engine;
+}
\ No newline at end of file
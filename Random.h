@@ -0,0 +1,53 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_RANDOM_H
+#define BUCKSHOT_ROULETTE_BOT_RANDOM_H
+
+#include <cstdint>
+#include <random>
+
+/**
+ * @class Random
+ * @brief Seeding helpers for the engines that load shells and deal items.
+ *
+ * Every Game owns its own engine, so games running on different threads
+ * never share generator state.  A batch of games is reproducible from one
+ * master seed: game i is seeded with gameSeed(master, i), which does not
+ * depend on which thread plays it or in what order.
+ */
+class Random {
+public:
+  // Engine type used for all game randomness.
+  using Engine = std::mt19937;
+
+  /**
+   * @brief Derives the seed of one game in a batch.
+   * @param masterSeed Seed of the whole batch.
+   * @param gameIndex Index of the game within the batch.
+   * @return A well-mixed 64-bit seed.
+   */
+  [[nodiscard]] static uint64_t gameSeed(uint64_t masterSeed,
+                                         uint64_t gameIndex) noexcept;
+
+  /**
+   * @brief Creates an engine from a 64-bit seed.
+   * @param seed The seed; all 64 bits contribute.
+   * @return The seeded engine.
+   */
+  [[nodiscard]] static Engine makeEngine(uint64_t seed);
+
+  /**
+   * @brief Draws a fresh, unpredictable seed.
+   * @return A seed taken from this thread's default engine.
+   */
+  [[nodiscard]] static uint64_t randomSeed();
+
+  /**
+   * @brief This thread's default engine, seeded from std::random_device.
+   *
+   * Used by callers that do not supply an engine of their own.
+   *
+   * @return Reference to the thread-local engine.
+   */
+  [[nodiscard]] static Engine &threadEngine();
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_RANDOM_H
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_ACTIONLIST_H
+#define BUCKSHOT_ROULETTE_BOT_ACTIONLIST_H
+
+#include "Player.h"
+
+/**
+ * @struct ActionList
+ * @brief The actions available at one search node, stored in place.
+ *
+ * A position never offers the same action twice, so ACTION_COUNT slots
+ * always suffice and generating or reordering a node's actions never
+ * allocates.
+ */
+struct ActionList {
+  Action actions[ACTION_COUNT]; ///< The actions; only the first count set.
+  int count = 0;                ///< Actions in the list.
+
+  /**
+   * @brief Appends an action.
+   * @param action The action, not already in the list.
+   */
+  void push(Action action) noexcept { actions[count++] = action; }
+
+  /**
+   * @brief Gets the number of actions.
+   * @return Action count.
+   */
+  [[nodiscard]] int size() const noexcept { return count; }
+
+  /**
+   * @brief Checks whether the list is empty.
+   * @return True if it holds no action.
+   */
+  [[nodiscard]] bool empty() const noexcept { return count == 0; }
+
+  /**
+   * @brief Gets one action.
+   * @param index Position in the list, below size().
+   * @return The action.
+   */
+  [[nodiscard]] Action operator[](int index) const noexcept {
+    return actions[index];
+  }
+
+  /** @brief First action. */
+  [[nodiscard]] Action *begin() noexcept { return actions; }
+  /** @brief One past the last action. */
+  [[nodiscard]] Action *end() noexcept { return actions + count; }
+  /** @brief First action. */
+  [[nodiscard]] const Action *begin() const noexcept { return actions; }
+  /** @brief One past the last action. */
+  [[nodiscard]] const Action *end() const noexcept { return actions + count; }
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_ACTIONLIST_H
\ No newline at end of file
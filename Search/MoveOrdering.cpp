@@ -0,0 +1,129 @@
+#include "Search/MoveOrdering.h"
+
+namespace {
+// Sort-key classes above every history score: the principal variation, the
+// stored best action, then the killers, most recent first.
+constexpr uint64_t PV_ACTION_CLASS = 4;
+constexpr uint64_t TT_ACTION_CLASS = 3;
+constexpr uint64_t FIRST_KILLER_CLASS = 2;
+constexpr uint64_t SECOND_KILLER_CLASS = 1;
+} // namespace
+
+MoveOrdering::MoveOrdering() noexcept { clear(); }
+
+void MoveOrdering::clear() noexcept {
+  for (auto &slots : killers) {
+    for (auto &killer : slots)
+      killer = NO_ACTION;
+  }
+  for (auto &side : history) {
+    for (auto &action : side) {
+      for (auto &score : action)
+        score = 0;
+    }
+  }
+  principalVariation.length = 0;
+}
+
+void MoveOrdering::followPrincipalVariation(const PrincipalVariation &line,
+                                            int rootDepth) noexcept {
+  principalVariation = line;
+  principalVariationRoot = rootDepth;
+}
+
+int MoveOrdering::strategicPriority(const SearchState &state,
+                                    Action action) noexcept {
+  const SearchState::Side &actingPlayer = state.current();
+  if ((action == Action::SHOOT_SELF && actingPlayer.shellRevealed &&
+       actingPlayer.knownShell == ShellType::BLANK_SHELL) ||
+      (action == Action::SHOOT_OPPONENT && actingPlayer.shellRevealed &&
+       actingPlayer.knownShell == ShellType::LIVE_SHELL) ||
+      action == Action::USE_MAGNIFYING_GLASS)
+    return 2;
+  if (action == Action::USE_HANDCUFFS || action == Action::USE_HANDSAW ||
+      action == Action::DRINK_BEER)
+    return 1;
+  return 0;
+}
+
+int MoveOrdering::feature(const SearchState &state) noexcept {
+  // What the mover knows about the next shell, from the magnifying glass
+  // or because only one kind is left.
+  const SearchState::Side &actingPlayer = state.current();
+  int knowledge = 0;
+  if ((actingPlayer.shellRevealed &&
+       actingPlayer.knownShell == ShellType::LIVE_SHELL) ||
+      state.blankShells == 0)
+    knowledge = 1;
+  else if ((actingPlayer.shellRevealed &&
+            actingPlayer.knownShell == ShellType::BLANK_SHELL) ||
+           state.liveShells == 0)
+    knowledge = 2;
+  return knowledge * 2 + (state.sawActive ? 1 : 0);
+}
+
+void MoveOrdering::order(const SearchState &state, int depth, int ttAction,
+                         ActionList &actions) const noexcept {
+  const int side = state.currentIndex();
+  const int positionFeature = feature(state);
+  const int8_t *depthKillers = killers[depth];
+  const int ply = principalVariationRoot - depth;
+  int pvAction = NO_ACTION;
+  if (ply >= 0 && ply < principalVariation.length &&
+      principalVariation.keys[ply] == state.hash)
+    pvAction = static_cast<int>(principalVariation.actions[ply]);
+
+  uint64_t keys[ACTION_COUNT];
+  for (int i = 0; i < actions.size(); ++i) {
+    const Action action = actions[i];
+    const int index = static_cast<int>(action);
+    uint64_t actionClass = 0;
+    if (index == pvAction)
+      actionClass = PV_ACTION_CLASS;
+    else if (index == ttAction)
+      actionClass = TT_ACTION_CLASS;
+    else if (index == depthKillers[0])
+      actionClass = FIRST_KILLER_CLASS;
+    else if (index == depthKillers[1])
+      actionClass = SECOND_KILLER_CLASS;
+    // History scores stay below HISTORY_LIMIT, well under 2^30.
+    keys[i] = (actionClass << 32) |
+              (uint64_t{history[side][index][positionFeature]} << 2) |
+              static_cast<uint64_t>(strategicPriority(state, action));
+  }
+
+  // Insertion sort, descending and stable: at most ACTION_COUNT entries.
+  for (int i = 1; i < actions.size(); ++i) {
+    const uint64_t key = keys[i];
+    const Action action = actions.actions[i];
+    int j = i - 1;
+    while (j >= 0 && keys[j] < key) {
+      keys[j + 1] = keys[j];
+      actions.actions[j + 1] = actions.actions[j];
+      --j;
+    }
+    keys[j + 1] = key;
+    actions.actions[j + 1] = action;
+  }
+}
+
+void MoveOrdering::recordCutoff(const SearchState &state, int depth,
+                                Action action) noexcept {
+  const auto index = static_cast<int8_t>(action);
+  int8_t *depthKillers = killers[depth];
+  if (depthKillers[0] != index) {
+    depthKillers[1] = depthKillers[0];
+    depthKillers[0] = index;
+  }
+
+  uint32_t &score = history[state.currentIndex()][index][feature(state)];
+  score += static_cast<uint32_t>(depth * depth);
+  if (score >= HISTORY_LIMIT) {
+    for (auto &side : history) {
+      for (auto &actionScores : side) {
+        for (auto &entry : actionScores)
+          entry /= 2;
+      }
+    }
+  }
+}
\ No newline at end of file
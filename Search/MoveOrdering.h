@@ -0,0 +1,127 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_MOVEORDERING_H
+#define BUCKSHOT_ROULETTE_BOT_MOVEORDERING_H
+
+#include "Player.h"
+#include "Search/ActionList.h"
+#include "Search/SearchLimits.h"
+#include "Search/SearchState.h"
+#include <cstdint>
+
+/**
+ * @struct PrincipalVariation
+ * @brief The line a search expects, from its root.
+ *
+ * At chance nodes the line follows the likelier shell.
+ */
+struct PrincipalVariation {
+  uint64_t keys[SearchLimits::MAX_DEPTH] = {};  ///< Hash of each position.
+  Action actions[SearchLimits::MAX_DEPTH] = {}; ///< Action played there.
+  int length = 0;                               ///< Positions on the line.
+};
+
+/**
+ * @class MoveOrdering
+ * @brief Orders a node's actions so the likeliest cutoff is searched first.
+ *
+ * Actions are tried in this order:
+ *   1. on the principal variation of the previous iteration, its action;
+ *   2. the best action stored for the position in the transposition table;
+ *   3. the killers: the last two actions that caused a cutoff at the same
+ *      remaining depth (within one iteration, the same ply);
+ *   4. the rest, by history score, then by strategicPriority().
+ *
+ * The history score of an action counts the cutoffs it caused, weighted by
+ * depth squared, for the side to move and a coarse feature of the
+ * position: what the mover knows about the next shell and whether the saw
+ * is active.  Equal keys keep the order the actions were generated in.
+ *
+ * The previous iteration's line only reorders actions.  Principal variation
+ * search and aspiration windows were measured on top of it and left out:
+ * Star1 rescales the window at every chance node, so a null window does
+ * not stay narrow, and both searched more nodes than the full window.
+ *
+ * An ordering belongs to one search thread; it is not safe to share.
+ */
+class MoveOrdering {
+public:
+  // Killer actions remembered per remaining depth.
+  static constexpr int KILLERS_PER_DEPTH = 2;
+  // Shell knowledge (unknown, live, blank) times saw state (off, on).
+  static constexpr int FEATURE_COUNT = 6;
+  // Once a history score reaches this, every score is halved, so recent
+  // cutoffs outweigh old ones and scores stay small.
+  static constexpr uint32_t HISTORY_LIMIT = uint32_t{1} << 20;
+  // Marks an empty killer slot, or no stored best action.
+  static constexpr int NO_ACTION = -1;
+
+  /**
+   * @brief Creates an ordering with no killers or history.
+   */
+  MoveOrdering() noexcept;
+
+  /**
+   * @brief Sorts a node's actions, best first.
+   * @param state The node's position.
+   * @param depth The node's remaining depth.
+   * @param ttAction Best action stored for the position, or NO_ACTION.
+   * @param actions The node's actions, sorted in place.
+   */
+  void order(const SearchState &state, int depth, int ttAction,
+             ActionList &actions) const noexcept;
+
+  /**
+   * @brief Records the action that caused a cutoff.
+   * @param state The node's position.
+   * @param depth The node's remaining depth.
+   * @param action The action.
+   */
+  void recordCutoff(const SearchState &state, int depth,
+                    Action action) noexcept;
+
+  /**
+   * @brief Sets the line to try first in the next iteration.
+   * @param line The previous iteration's principal variation.
+   * @param rootDepth Depth of the next iteration, so positions on the line
+   * are recognized by their remaining depth.
+   */
+  void followPrincipalVariation(const PrincipalVariation &line,
+                                int rootDepth) noexcept;
+
+  /**
+   * @brief Forgets every killer and history score, and the line.
+   */
+  void clear() noexcept;
+
+  /**
+   * @brief Ranks an action by what it is known to be good for.
+   *
+   * Highest are shots at a known shell (self on blank, opponent on live)
+   * and the magnifying glass; then handcuffs, handsaw and beer (a tempo
+   * tool for manipulating shell odds); then everything else.
+   *
+   * @param state The position.
+   * @param action The action.
+   * @return 2, 1 or 0, higher first.
+   */
+  [[nodiscard]] static int strategicPriority(const SearchState &state,
+                                             Action action) noexcept;
+
+private:
+  /**
+   * @brief Computes the history feature of a position.
+   * @param state The position.
+   * @return A value in [0, FEATURE_COUNT).
+   */
+  [[nodiscard]] static int feature(const SearchState &state) noexcept;
+
+  // Cutoff actions per remaining depth, most recent first; NO_ACTION if
+  // empty.
+  int8_t killers[SearchLimits::MAX_DEPTH + 1][KILLERS_PER_DEPTH];
+  // Depth-squared cutoff counts by side to move, action and feature.
+  uint32_t history[2][ACTION_COUNT][FEATURE_COUNT];
+  // Line to try first, and the depth of the iteration following it.
+  PrincipalVariation principalVariation;
+  int principalVariationRoot = 0;
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_MOVEORDERING_H
\ No newline at end of file
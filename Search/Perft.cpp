@@ -0,0 +1,84 @@
+#include "Search/Perft.h"
+#include "BotPlayer.h"
+#include "Exceptions.h"
+
+namespace {
+// Same leaf test as BotPlayer::expectiMiniMax().
+bool isLeaf(const SearchState &state, int depth) {
+  return depth == 0 || state.players[SearchState::PLAYER_ONE].health <= 0 ||
+         state.players[SearchState::PLAYER_TWO].health <= 0 ||
+         state.totalShells() == 0;
+}
+
+void expandNode(SearchState &state, int depth, bool verify,
+                PerftCounts &counts);
+
+// Plays each shell outcome of one action and counts what lies below.
+void expandAction(SearchState &state, Action action, int depth, bool verify,
+                  PerftCounts &counts) {
+  BotPlayer::ChanceOutcome outcomes[2];
+  const int outcomeCount = BotPlayer::chanceOutcomes(state, action, outcomes);
+  if (outcomeCount > 1)
+    ++counts.chanceNodes;
+
+  for (int i = 0; i < outcomeCount; ++i) {
+    const SearchState before = state;
+    SearchState::UndoRecord undo;
+    state.apply(action, outcomes[i].shell, undo);
+    expandNode(state, depth - 1, verify, counts);
+    state.undo(undo);
+    if (verify && state != before)
+      throw SimulationException("undo() did not restore " +
+                                before.toString() + " (got " +
+                                state.toString() + ")");
+  }
+}
+
+void expandNode(SearchState &state, int depth, bool verify,
+                PerftCounts &counts) {
+  if (verify && state.hash != state.computeHash())
+    throw SimulationException("Hash out of sync at " + state.toString());
+  if (isLeaf(state, depth)) {
+    ++counts.leafNodes;
+    return;
+  }
+
+  ++counts.decisionNodes;
+  for (Action action : BotPlayer::determineFeasibleActions(state))
+    expandAction(state, action, depth, verify, counts);
+}
+} // namespace
+
+PerftCounts &PerftCounts::operator+=(const PerftCounts &other) noexcept {
+  decisionNodes += other.decisionNodes;
+  chanceNodes += other.chanceNodes;
+  leafNodes += other.leafNodes;
+  return *this;
+}
+
+PerftCounts Perft::count(const SearchState &state, int depth, bool verify) {
+  if (depth < 0)
+    throw InvalidGameArgumentException("Perft depth must not be negative");
+  SearchState root = state;
+  PerftCounts counts;
+  expandNode(root, depth, verify, counts);
+  return counts;
+}
+
+std::vector<PerftDivision> Perft::divide(const SearchState &state, int depth,
+                                         bool verify) {
+  if (depth < 1)
+    throw InvalidGameArgumentException("Perft divide needs a depth of 1 or "
+                                       "more");
+  std::vector<PerftDivision> divisions;
+  if (isLeaf(state, depth))
+    return divisions;
+
+  SearchState root = state;
+  for (Action action : BotPlayer::determineFeasibleActions(root)) {
+    PerftDivision division{action, {}};
+    expandAction(root, action, depth, verify, division.counts);
+    divisions.push_back(division);
+  }
+  return divisions;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_PERFT_H
+#define BUCKSHOT_ROULETTE_BOT_PERFT_H
+
+#include "Search/SearchState.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct PerftCounts
+ * @brief Nodes of a fully expanded search tree, by kind.
+ */
+struct PerftCounts {
+  uint64_t decisionNodes = 0; ///< Positions where a player picks an action.
+  uint64_t chanceNodes = 0;   ///< Actions whose shell is still uncertain.
+  uint64_t leafNodes = 0;     ///< Positions at depth 0 or with the round over.
+
+  /**
+   * @brief Total nodes of every kind.
+   * @return The sum of the three counts.
+   */
+  [[nodiscard]] uint64_t total() const noexcept {
+    return decisionNodes + chanceNodes + leafNodes;
+  }
+
+  /**
+   * @brief Adds another tree's counts to these.
+   * @param other The counts to add.
+   * @return This object.
+   */
+  PerftCounts &operator+=(const PerftCounts &other) noexcept;
+};
+
+/**
+ * @struct PerftDivision
+ * @brief Counts of the subtree below one root action.
+ */
+struct PerftDivision {
+  Action action;      ///< The root action.
+  PerftCounts counts; ///< Its subtree; the root itself is not counted.
+};
+
+/**
+ * @class Perft
+ * @brief Counts the nodes of the expectiminimax tree without pruning.
+ *
+ * The tree is expanded exactly as BotPlayer's search expands it:
+ * determineFeasibleActions() lists the actions at each decision node,
+ * chanceOutcomes() splits an action into its shell outcomes, and
+ * SearchState::apply()/undo() play them.  A position is a leaf once the
+ * depth is used up, either player is out of health or the magazine is
+ * empty.  Every node is visited, so the counts change only when the move
+ * generator or the rules do; that makes them a reference to check a
+ * rewritten generator or state against, and a raw throughput measure.
+ */
+class Perft {
+public:
+  /**
+   * @brief Counts the tree below a position.
+   * @param state The root position.
+   * @param depth Decision levels to expand.
+   * @param verify Also check at every node that the hash matches
+   * computeHash() and that undo() restores the position exactly.
+   * @return The node counts, the root included.
+   * @throws InvalidGameArgumentException If depth is negative.
+   * @throws SimulationException If a generated action cannot be applied,
+   * or, when verifying, a check fails.
+   */
+  [[nodiscard]] static PerftCounts count(const SearchState &state, int depth,
+                                         bool verify);
+
+  /**
+   * @brief Counts the subtree below each root action separately.
+   *
+   * Summing the divisions and adding the root decision node gives count();
+   * comparing two builds' divisions narrows a mismatch to one action.
+   *
+   * @param state The root position.
+   * @param depth Decision levels to expand, at least 1.
+   * @param verify As for count().
+   * @return One division per feasible root action, in generation order;
+   * none if the root is already a leaf.
+   * @throws InvalidGameArgumentException If depth is below 1.
+   * @throws SimulationException As for count().
+   */
+  [[nodiscard]] static std::vector<PerftDivision>
+  divide(const SearchState &state, int depth, bool verify);
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_PERFT_H
\ No newline at end of file
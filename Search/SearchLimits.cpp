@@ -0,0 +1,13 @@
+#include "Search/SearchLimits.h"
+#include "Exceptions.h"
+#include <string>
+
+void SearchLimits::validate() const {
+  if (maxDepth < 1 || maxDepth > MAX_DEPTH) {
+    throw InvalidGameArgumentException("Search depth must be between 1 and " +
+                                       std::to_string(MAX_DEPTH) + ".");
+  }
+  if (timeLimit.count() < 0) {
+    throw InvalidGameArgumentException("Time limit must not be negative.");
+  }
+}
\ No newline at end of file
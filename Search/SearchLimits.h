@@ -0,0 +1,41 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_SEARCHLIMITS_H
+#define BUCKSHOT_ROULETTE_BOT_SEARCHLIMITS_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @struct SearchLimits
+ * @brief When a bot's iterative deepening stops.
+ *
+ * Deepening stops at the first limit reached; an iteration cut short by the
+ * node budget or the clock is discarded and the last completed depth
+ * decides.  A node is one expectiminimax call, counted over every search
+ * thread.  Budget and clock are checked every NODE_CHECK_INTERVAL nodes per
+ * thread, so a search can overrun its budget by up to that many nodes per
+ * thread.
+ *
+ * With a node budget, no time limit and one search thread, a bot plays the
+ * same moves whatever the machine or its load.
+ */
+struct SearchLimits {
+  // Deepest iteration any search runs.
+  static constexpr int MAX_DEPTH = 20;
+  // Standard wall-clock bound per move.
+  static constexpr std::chrono::milliseconds DEFAULT_TIME_LIMIT{7000};
+  // Nodes each thread searches between checks of the budget and clock.
+  static constexpr uint64_t NODE_CHECK_INTERVAL = 1024;
+
+  uint64_t maxNodes = 0;  ///< Node budget per move; 0 for none.
+  int maxDepth = MAX_DEPTH; ///< Deepest iteration, 1..MAX_DEPTH.
+  std::chrono::milliseconds timeLimit =
+      DEFAULT_TIME_LIMIT; ///< Wall-clock bound per move; 0 for none.
+
+  /**
+   * @brief Checks that the limits can be searched with.
+   * @throws InvalidGameArgumentException If any value is out of range.
+   */
+  void validate() const;
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_SEARCHLIMITS_H
\ No newline at end of file
@@ -0,0 +1,479 @@
+#include "SearchState.h"
+#include "Exceptions.h"
+#include "Game.h"
+#include "Player.h"
+#include "Zobrist.h"
+#include <charconv>
+#include <sstream>
+
+namespace {
+SearchState::Side sideFromPlayer(const Player &player) {
+  SearchState::Side side{};
+  side.health = static_cast<int8_t>(player.getHealth());
+  for (int kind = 0; kind < ITEM_KIND_COUNT; ++kind)
+    side.items[kind] =
+        static_cast<uint8_t>(player.countItem(static_cast<ItemKind>(kind)));
+  side.handcuffed = player.areHandcuffsApplied();
+  side.usedHandcuffsThisTurn = player.hasUsedHandcuffsThisTurn();
+  side.shellRevealed = player.isNextShellRevealed();
+  side.knownShell = player.returnKnownNextShell();
+  return side;
+}
+
+SearchState stateFrom(const Player &playerOne, const Player &playerTwo,
+                      const Shotgun &shotgun, bool playerOneTurn) {
+  SearchState state{};
+  state.players[SearchState::PLAYER_ONE] = sideFromPlayer(playerOne);
+  state.players[SearchState::PLAYER_TWO] = sideFromPlayer(playerTwo);
+  state.liveShells = static_cast<uint8_t>(shotgun.getLiveShellCount());
+  state.blankShells = static_cast<uint8_t>(shotgun.getBlankShellCount());
+  state.sawActive = shotgun.getSawUsed();
+  state.playerOneTurn = playerOneTurn;
+  // Both players share the game's health cap.
+  state.maxHealth = static_cast<int8_t>(playerOne.getMaxHealth());
+  state.hash = state.computeHash();
+  return state;
+}
+
+// The item an action consumes, if any.
+bool consumedItem(Action action, ItemKind &kind) {
+  switch (action) {
+  case Action::SMOKE_CIGARETTE:
+    kind = ItemKind::CIGARETTE;
+    return true;
+  case Action::USE_HANDCUFFS:
+    kind = ItemKind::HANDCUFFS;
+    return true;
+  case Action::USE_MAGNIFYING_GLASS:
+    kind = ItemKind::MAGNIFYING_GLASS;
+    return true;
+  case Action::DRINK_BEER:
+    kind = ItemKind::BEER;
+    return true;
+  case Action::USE_HANDSAW:
+    kind = ItemKind::HANDSAW;
+    return true;
+  default:
+    return false;
+  }
+}
+
+// One letter per item kind, in ItemKind order, for position text.
+constexpr char ITEM_LETTERS[ITEM_KIND_COUNT] = {'B', 'C', 'H', 'S', 'M'};
+
+[[noreturn]] void malformed(std::string_view text, const std::string &why) {
+  throw InvalidGameArgumentException("Bad position \"" + std::string(text) +
+                                     "\": " + why);
+}
+
+// Parses a whole field as a decimal integer.
+bool parseInt(std::string_view field, int &value) {
+  const char *end = field.data() + field.size();
+  const auto result = std::from_chars(field.data(), end, value);
+  return !field.empty() && result.ec == std::errc() && result.ptr == end;
+}
+
+// Splits `<a>/<b>[/<c>...]` into exactly `count` parts.
+bool splitSlashes(std::string_view field, std::string_view *parts,
+                  int count) {
+  for (int i = 0; i < count - 1; ++i) {
+    const size_t slash = field.find('/');
+    if (slash == std::string_view::npos)
+      return false;
+    parts[i] = field.substr(0, slash);
+    field.remove_prefix(slash + 1);
+  }
+  parts[count - 1] = field;
+  return field.find('/') == std::string_view::npos;
+}
+
+SearchState::Side parseSide(std::string_view text, std::string_view field,
+                            int maxHealth) {
+  std::string_view parts[3];
+  int health;
+  if (!splitSlashes(field, parts, 3) || !parseInt(parts[0], health))
+    malformed(text, "expected <health>/<items>/<flags>, got \"" +
+                        std::string(field) + "\"");
+  if (health < 0 || health > maxHealth)
+    malformed(text, "health " + std::to_string(health) + " is outside 0.." +
+                        std::to_string(maxHealth));
+
+  SearchState::Side side{};
+  side.health = static_cast<int8_t>(health);
+  side.knownShell = ShellType::BLANK_SHELL;
+  if (parts[1] != "-") {
+    if (parts[1].size() > static_cast<size_t>(MAX_ITEMS))
+      malformed(text, "more than " + std::to_string(MAX_ITEMS) + " items");
+    for (char letter : parts[1]) {
+      int kind = 0;
+      while (kind < ITEM_KIND_COUNT && ITEM_LETTERS[kind] != letter)
+        ++kind;
+      if (kind == ITEM_KIND_COUNT)
+        malformed(text, std::string("unknown item '") + letter + "'");
+      ++side.items[kind];
+    }
+  }
+  if (parts[2] != "-") {
+    for (char flag : parts[2]) {
+      switch (flag) {
+      case 'x':
+        side.handcuffed = true;
+        break;
+      case 'u':
+        side.usedHandcuffsThisTurn = true;
+        break;
+      case 'l':
+      case 'b':
+        if (side.shellRevealed)
+          malformed(text, "a player knows the next shell twice");
+        side.shellRevealed = true;
+        side.knownShell =
+            flag == 'l' ? ShellType::LIVE_SHELL : ShellType::BLANK_SHELL;
+        break;
+      default:
+        malformed(text, std::string("unknown flag '") + flag + "'");
+      }
+    }
+  }
+  return side;
+}
+
+void writeSide(std::string &out, const SearchState::Side &side) {
+  out += std::to_string(side.health);
+  out += '/';
+  const size_t itemsStart = out.size();
+  for (int kind = 0; kind < ITEM_KIND_COUNT; ++kind)
+    out.append(side.items[kind], ITEM_LETTERS[kind]);
+  if (out.size() == itemsStart)
+    out += '-';
+  out += '/';
+  const size_t flagsStart = out.size();
+  if (side.handcuffed)
+    out += 'x';
+  if (side.usedHandcuffsThisTurn)
+    out += 'u';
+  if (side.shellRevealed)
+    out += side.knownShell == ShellType::LIVE_SHELL ? 'l' : 'b';
+  if (out.size() == flagsStart)
+    out += '-';
+}
+} // namespace
+
+SearchState SearchState::fromPlayers(const Player &self,
+                                     const Player &opponent,
+                                     const Shotgun &shotgun) {
+  SearchState state = stateFrom(self, opponent, shotgun, true);
+  // Only the side to move can have spent handcuffs this turn.
+  if (state.players[PLAYER_TWO].usedHandcuffsThisTurn) {
+    state.setUsedHandcuffsThisTurn(PLAYER_TWO, false);
+  }
+  return state;
+}
+
+SearchState SearchState::fromGame(const Game &game) {
+  if (!game.getPlayerOne() || !game.getPlayerTwo() || !game.getShotgun()) {
+    throw SimulationException("Cannot build a search state from an "
+                              "incomplete game.");
+  }
+  return stateFrom(*game.getPlayerOne(), *game.getPlayerTwo(),
+                   *game.getShotgun(), game.isPlayerOneTurnNow());
+}
+
+SearchState SearchState::mirrored() const noexcept {
+  SearchState swapped = *this;
+  swapped.players[PLAYER_ONE] = players[PLAYER_TWO];
+  swapped.players[PLAYER_TWO] = players[PLAYER_ONE];
+  swapped.playerOneTurn = !playerOneTurn;
+  swapped.hash = swapped.computeHash();
+  return swapped;
+}
+
+SearchState SearchState::fromString(std::string_view text) {
+  std::istringstream in{std::string(text)};
+  std::string fields[6];
+  for (auto &field : fields)
+    if (!(in >> field))
+      malformed(text, "expected 6 fields");
+  std::string extra;
+  if (in >> extra)
+    malformed(text, "unexpected \"" + extra + "\" after the saw field");
+
+  int maxHealth;
+  if (!parseInt(fields[0], maxHealth) || maxHealth < 1 ||
+      maxHealth >= Zobrist::MAX_TRACKED_HEALTH)
+    malformed(text, "max health must be 1.." +
+                        std::to_string(Zobrist::MAX_TRACKED_HEALTH - 1));
+
+  SearchState state{};
+  state.maxHealth = static_cast<int8_t>(maxHealth);
+  state.players[PLAYER_ONE] = parseSide(text, fields[1], maxHealth);
+  state.players[PLAYER_TWO] = parseSide(text, fields[2], maxHealth);
+
+  std::string_view shells[2];
+  int live;
+  int blank;
+  if (!splitSlashes(fields[3], shells, 2) || !parseInt(shells[0], live) ||
+      !parseInt(shells[1], blank) || live < 0 || blank < 0 ||
+      live + blank > Shotgun::MAX_SHELLS)
+    malformed(text, "shells must be <live>/<blank> with at most " +
+                        std::to_string(Shotgun::MAX_SHELLS) + " in total");
+  state.liveShells = static_cast<uint8_t>(live);
+  state.blankShells = static_cast<uint8_t>(blank);
+  for (const Side &side : state.players)
+    if (side.shellRevealed && (side.knownShell == ShellType::LIVE_SHELL
+                                   ? live == 0
+                                   : blank == 0))
+      malformed(text, "a revealed shell is not in the magazine");
+
+  if (fields[4] != "1" && fields[4] != "2")
+    malformed(text, "the side to move must be 1 or 2");
+  state.playerOneTurn = fields[4] == "1";
+  if (fields[5] != "s" && fields[5] != "-")
+    malformed(text, "the saw field must be s or -");
+  state.sawActive = fields[5] == "s";
+
+  state.hash = state.computeHash();
+  return state;
+}
+
+std::string SearchState::toString() const {
+  std::string out = std::to_string(maxHealth);
+  out += ' ';
+  writeSide(out, players[PLAYER_ONE]);
+  out += ' ';
+  writeSide(out, players[PLAYER_TWO]);
+  out += ' ' + std::to_string(liveShells) + '/' + std::to_string(blankShells);
+  out += playerOneTurn ? " 1" : " 2";
+  out += sawActive ? " s" : " -";
+  return out;
+}
+
+bool SearchState::operator==(const SearchState &other) const noexcept {
+  for (int side = 0; side < 2; ++side) {
+    const Side &mine = players[side];
+    const Side &theirs = other.players[side];
+    if (mine.health != theirs.health || mine.handcuffed != theirs.handcuffed ||
+        mine.usedHandcuffsThisTurn != theirs.usedHandcuffsThisTurn ||
+        mine.shellRevealed != theirs.shellRevealed ||
+        (mine.shellRevealed && mine.knownShell != theirs.knownShell))
+      return false;
+    for (int kind = 0; kind < ITEM_KIND_COUNT; ++kind)
+      if (mine.items[kind] != theirs.items[kind])
+        return false;
+  }
+  return liveShells == other.liveShells && blankShells == other.blankShells &&
+         sawActive == other.sawActive &&
+         playerOneTurn == other.playerOneTurn &&
+         maxHealth == other.maxHealth && hash == other.hash;
+}
+
+uint64_t SearchState::computeHash() const noexcept {
+  uint64_t key = Zobrist::liveShellKey(liveShells) ^
+                 Zobrist::blankShellKey(blankShells);
+  for (int side = 0; side < 2; ++side) {
+    const Side &player = players[side];
+    key ^= Zobrist::healthKey(side, player.health);
+    for (int kind = 0; kind < ITEM_KIND_COUNT; ++kind)
+      key ^= Zobrist::itemKey(side, static_cast<ItemKind>(kind),
+                              player.items[kind]);
+    if (player.handcuffed)
+      key ^= Zobrist::handcuffedKey(side);
+    if (player.usedHandcuffsThisTurn)
+      key ^= Zobrist::handcuffsUsedKey(side);
+    if (player.shellRevealed)
+      key ^= Zobrist::revealedKey(side, player.knownShell);
+  }
+  if (sawActive)
+    key ^= Zobrist::sawKey();
+  if (playerOneTurn)
+    key ^= Zobrist::playerOneTurnKey();
+  return key;
+}
+
+void SearchState::setHealth(int side, int health) noexcept {
+  hash ^= Zobrist::healthKey(side, players[side].health) ^
+          Zobrist::healthKey(side, health);
+  players[side].health = static_cast<int8_t>(health);
+}
+
+void SearchState::removeItem(int side, ItemKind kind) {
+  uint8_t &count = players[side].items[static_cast<int>(kind)];
+  if (count == 0) {
+    throw SimulationException("No item of that kind to remove in simulation.");
+  }
+  hash ^= Zobrist::itemKey(side, kind, count) ^
+          Zobrist::itemKey(side, kind, count - 1);
+  --count;
+}
+
+void SearchState::setHandcuffed(int side, bool value) noexcept {
+  if (players[side].handcuffed != value)
+    hash ^= Zobrist::handcuffedKey(side);
+  players[side].handcuffed = value;
+}
+
+void SearchState::setUsedHandcuffsThisTurn(int side, bool value) noexcept {
+  if (players[side].usedHandcuffsThisTurn != value)
+    hash ^= Zobrist::handcuffsUsedKey(side);
+  players[side].usedHandcuffsThisTurn = value;
+}
+
+void SearchState::revealShell(int side, ShellType shell) noexcept {
+  forgetShell(side);
+  hash ^= Zobrist::revealedKey(side, shell);
+  players[side].shellRevealed = true;
+  players[side].knownShell = shell;
+}
+
+void SearchState::forgetShell(int side) noexcept {
+  if (players[side].shellRevealed)
+    hash ^= Zobrist::revealedKey(side, players[side].knownShell);
+  players[side].shellRevealed = false;
+}
+
+void SearchState::setSawActive(bool value) noexcept {
+  if (sawActive != value)
+    hash ^= Zobrist::sawKey();
+  sawActive = value;
+}
+
+void SearchState::removeShell(ShellType shell) {
+  if (shell == ShellType::LIVE_SHELL) {
+    if (liveShells == 0) {
+      throw SimulationException("No live shells available for simulation.");
+    }
+    hash ^= Zobrist::liveShellKey(liveShells) ^
+            Zobrist::liveShellKey(liveShells - 1);
+    --liveShells;
+  } else {
+    if (blankShells == 0) {
+      throw SimulationException("No blank shells available for simulation.");
+    }
+    hash ^= Zobrist::blankShellKey(blankShells) ^
+            Zobrist::blankShellKey(blankShells - 1);
+    --blankShells;
+  }
+}
+
+void SearchState::setPlayerOneTurn(bool value) noexcept {
+  if (playerOneTurn != value)
+    hash ^= Zobrist::playerOneTurnKey();
+  playerOneTurn = value;
+}
+
+
+void SearchState::apply(Action action, ShellType shell, UndoRecord &undo) {
+  const int current = currentIndex();
+  const int other = 1 - current;
+  const bool drawsShell = action == Action::SHOOT_SELF ||
+                          action == Action::SHOOT_OPPONENT ||
+                          action == Action::DRINK_BEER;
+
+  ItemKind kind{};
+  const bool usesItem = consumedItem(action, kind);
+  if (usesItem && !hasItem(current, kind)) {
+    throw SimulationException("No item of that kind to remove in simulation.");
+  }
+  if (drawsShell && (shell == ShellType::LIVE_SHELL ? liveShells
+                                                    : blankShells) == 0) {
+    throw SimulationException("No shell of that type available for "
+                              "simulation.");
+  }
+
+  undo.hash = hash;
+  undo.action = action;
+  undo.shell = shell;
+  undo.health[PLAYER_ONE] = players[PLAYER_ONE].health;
+  undo.health[PLAYER_TWO] = players[PLAYER_TWO].health;
+  undo.otherHandcuffed = players[other].handcuffed;
+  undo.usedHandcuffsThisTurn = players[current].usedHandcuffsThisTurn;
+  undo.shellRevealed = players[current].shellRevealed;
+  undo.knownShell = players[current].knownShell;
+  undo.sawActive = sawActive;
+  undo.playerOneTurn = playerOneTurn;
+  undo.shellRemoved = drawsShell;
+
+  if (usesItem)
+    removeItem(current, kind);
+
+  bool passTurn = false;
+  switch (action) {
+  case Action::SHOOT_SELF:
+  case Action::SHOOT_OPPONENT: {
+    forgetShell(current);
+    if (shell == ShellType::LIVE_SHELL) {
+      const int target = action == Action::SHOOT_SELF ? current : other;
+      setHealth(target, players[target].health - (sawActive ? 2 : 1));
+    }
+    setSawActive(false);
+    removeShell(shell);
+    // A blank at yourself keeps the turn; anything else ends it.
+    if (action == Action::SHOOT_SELF && shell == ShellType::BLANK_SHELL)
+      break;
+    // If the opponent is handcuffed, skip their turn and allow re-cuffing.
+    setUsedHandcuffsThisTurn(current, false);
+    if (players[other].handcuffed)
+      setHandcuffed(other, false);
+    else
+      passTurn = true;
+    break;
+  }
+
+  case Action::USE_MAGNIFYING_GLASS:
+    revealShell(current, shell);
+    break;
+
+  case Action::SMOKE_CIGARETTE:
+    if (players[current].health < maxHealth)
+      setHealth(current, players[current].health + 1);
+    break;
+
+  case Action::DRINK_BEER:
+    // Beer racks the current shell out of the shotgun.
+    forgetShell(current);
+    removeShell(shell);
+    break;
+
+  case Action::USE_HANDSAW:
+    setSawActive(true);
+    break;
+
+  case Action::USE_HANDCUFFS:
+    setHandcuffed(other, true);
+    setUsedHandcuffsThisTurn(current, true);
+    break;
+
+  default:
+    passTurn = true;
+    break;
+  }
+
+  if (passTurn)
+    setPlayerOneTurn(!playerOneTurn);
+}
+
+void SearchState::undo(const UndoRecord &undo) noexcept {
+  playerOneTurn = undo.playerOneTurn;
+  const int current = currentIndex();
+  const int other = 1 - current;
+
+  players[PLAYER_ONE].health = undo.health[PLAYER_ONE];
+  players[PLAYER_TWO].health = undo.health[PLAYER_TWO];
+  players[other].handcuffed = undo.otherHandcuffed;
+  players[current].usedHandcuffsThisTurn = undo.usedHandcuffsThisTurn;
+  players[current].shellRevealed = undo.shellRevealed;
+  players[current].knownShell = undo.knownShell;
+  sawActive = undo.sawActive;
+
+  if (undo.shellRemoved) {
+    if (undo.shell == ShellType::LIVE_SHELL)
+      ++liveShells;
+    else
+      ++blankShells;
+  }
+  ItemKind kind{};
+  if (consumedItem(undo.action, kind))
+    ++players[current].items[static_cast<int>(kind)];
+
+  hash = undo.hash;
+}
\ No newline at end of file
@@ -0,0 +1,309 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_SEARCHSTATE_H
+#define BUCKSHOT_ROULETTE_BOT_SEARCHSTATE_H
+
+#include "Items/Item.h"
+#include "Shotgun.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+class Game;
+class Player;
+enum class Action : int;
+
+/**
+ * @struct SearchState
+ * @brief Compact, trivially copyable game position used by the search.
+ *
+ * Holds only what the expectiminimax search reads: both players' health,
+ * per-kind item counts and status flags, the remaining live/blank counts,
+ * the saw state and the side to move.  The search copies it by value instead
+ * of deep-copying a SimulatedGame, so expanding a node never allocates.
+ *
+ * All mutators keep `hash` in sync with computeHash() by XORing the Zobrist
+ * keys of the feature they change.  The search walks the tree with apply()
+ * and undo() on a single instance rather than copying it per child.
+ */
+struct SearchState {
+  // Index of player one (the searching bot) in `players`.
+  static constexpr int PLAYER_ONE = 0;
+  // Index of player two (the opponent) in `players`.
+  static constexpr int PLAYER_TWO = 1;
+
+  /**
+   * @struct Side
+   * @brief Per-player portion of the position.
+   */
+  struct Side {
+    int8_t health;                       ///< Current health.
+    uint8_t items[ITEM_KIND_COUNT];      ///< Held items, counted per kind.
+    bool handcuffed;                     ///< Skips their next turn.
+    bool usedHandcuffsThisTurn;          ///< Already cuffed this turn.
+    bool shellRevealed;                  ///< Knows the next shell.
+    ShellType knownShell;                ///< The revealed shell, if any.
+  };
+
+  /**
+   * @struct UndoRecord
+   * @brief What apply() overwrote, so undo() can put it back.
+   */
+  struct UndoRecord {
+    uint64_t hash;              ///< Hash before the action.
+    Action action;              ///< The applied action.
+    ShellType shell;            ///< The shell it was applied with.
+    int8_t health[2];           ///< Both players' health before.
+    bool otherHandcuffed;       ///< Waiting side's handcuff flag before.
+    bool usedHandcuffsThisTurn; ///< Acting side's handcuff-use flag before.
+    bool shellRevealed;         ///< Acting side's shell knowledge before.
+    ShellType knownShell;       ///< Acting side's known shell before.
+    bool sawActive;             ///< Saw flag before.
+    bool playerOneTurn;         ///< Side to move before.
+    bool shellRemoved;          ///< Whether `shell` left the magazine.
+  };
+
+  Side players[2];      ///< Player one, then player two.
+  uint8_t liveShells;   ///< Live shells remaining.
+  uint8_t blankShells;  ///< Blank shells remaining.
+  bool sawActive;       ///< Next live shell deals double damage.
+  bool playerOneTurn;   ///< True if player one is to move.
+  int8_t maxHealth;     ///< Health cap for cigarettes and evaluation.
+  uint64_t hash;        ///< Zobrist hash of all of the above.
+
+  /**
+   * @brief Builds the root position from the searching player's view.
+   *
+   * The searching player becomes player one and is to move.
+   *
+   * @param self The player choosing an action.
+   * @param opponent Their opponent.
+   * @param shotgun The current shotgun.
+   * @return The search position.
+   */
+  [[nodiscard]] static SearchState fromPlayers(const Player &self,
+                                               const Player &opponent,
+                                               const Shotgun &shotgun);
+
+  /**
+   * @brief Builds a position from a game's players, shotgun and turn.
+   * @param game The game to convert.
+   * @return The search position.
+   */
+  [[nodiscard]] static SearchState fromGame(const Game &game);
+
+  /**
+   * @brief The same position with the players' seats swapped.
+   *
+   * Player one becomes player two and vice versa, and the turn flips with
+   * them, so the same side is still to move.
+   *
+   * @return The mirrored position.
+   */
+  [[nodiscard]] SearchState mirrored() const noexcept;
+
+  /**
+   * @brief Parses a position written by toString().
+   *
+   * A position is six space-separated fields:
+   *
+   *     <max health> <player one> <player two> <live>/<blank> <to move> <saw>
+   *
+   * Each player is `<health>/<items>/<flags>`.  Items are one letter per
+   * item held (B beer, C cigarette, H handcuffs, S handsaw, M magnifying
+   * glass); flags are x (handcuffed), u (used handcuffs this turn) and l or
+   * b (knows the next shell is live or blank).  An empty list is `-`.  The
+   * side to move is 1 or 2, and the saw field is s when a handsaw is active,
+   * `-` otherwise.  For example:
+   *
+   *     3 3/BCHSM/- 2/BHM/x 4/3 1 -
+   *
+   * @param text The position.
+   * @return The position, with its hash computed.
+   * @throws InvalidGameArgumentException If the text is malformed or the
+   * position could not occur in a game.
+   */
+  [[nodiscard]] static SearchState fromString(std::string_view text);
+
+  /**
+   * @brief Writes the position in the format fromString() reads.
+   *
+   * Items are listed in ItemKind order, so equal positions give equal text.
+   *
+   * @return The position as text.
+   */
+  [[nodiscard]] std::string toString() const;
+
+  /**
+   * @brief Compares every field the search reads, including the hash.
+   * @param other The position to compare with.
+   * @return True if the positions are the same.
+   */
+  [[nodiscard]] bool operator==(const SearchState &other) const noexcept;
+
+  /**
+   * @brief Negation of operator==.
+   * @param other The position to compare with.
+   * @return True if the positions differ.
+   */
+  [[nodiscard]] bool operator!=(const SearchState &other) const noexcept {
+    return !(*this == other);
+  }
+
+  /**
+   * @brief Computes the Zobrist hash from scratch.
+   * @return The hash of the current fields.
+   */
+  [[nodiscard]] uint64_t computeHash() const noexcept;
+
+  /**
+   * @brief Index of the side to move.
+   * @return PLAYER_ONE or PLAYER_TWO.
+   */
+  [[nodiscard]] int currentIndex() const noexcept {
+    return playerOneTurn ? PLAYER_ONE : PLAYER_TWO;
+  }
+
+  /**
+   * @brief The side to move.
+   * @return Reference to the acting side.
+   */
+  [[nodiscard]] const Side &current() const noexcept {
+    return players[currentIndex()];
+  }
+
+  /**
+   * @brief The side not to move.
+   * @return Reference to the waiting side.
+   */
+  [[nodiscard]] const Side &other() const noexcept {
+    return players[1 - currentIndex()];
+  }
+
+  /**
+   * @brief Total shells remaining.
+   * @return Live plus blank shells.
+   */
+  [[nodiscard]] int totalShells() const noexcept {
+    return liveShells + blankShells;
+  }
+
+  /**
+   * @brief Probability that the next shell is live.
+   * @return Probability between 0 and 1 (0 when empty).
+   */
+  [[nodiscard]] float liveProbability() const noexcept {
+    return totalShells() > 0 ? static_cast<float>(liveShells) /
+                                   static_cast<float>(totalShells())
+                             : 0.0f;
+  }
+
+  /**
+   * @brief Probability that the next shell is blank.
+   * @return Probability between 0 and 1 (0 when empty).
+   */
+  [[nodiscard]] float blankProbability() const noexcept {
+    return totalShells() > 0 ? static_cast<float>(blankShells) /
+                                   static_cast<float>(totalShells())
+                             : 0.0f;
+  }
+
+  /**
+   * @brief Checks whether a player holds at least one item of a kind.
+   * @param side Player index.
+   * @param kind The item kind.
+   * @return True if held.
+   */
+  [[nodiscard]] bool hasItem(int side, ItemKind kind) const noexcept {
+    return players[side].items[static_cast<int>(kind)] > 0;
+  }
+
+  /**
+   * @brief Sets a player's health.
+   * @param side Player index.
+   * @param health New health value.
+   */
+  void setHealth(int side, int health) noexcept;
+
+  /**
+   * @brief Removes one item of a kind from a player.
+   * @param side Player index.
+   * @param kind The item kind.
+   * @throws SimulationException If the player holds none.
+   */
+  void removeItem(int side, ItemKind kind);
+
+  /**
+   * @brief Sets whether a player is handcuffed.
+   * @param side Player index.
+   * @param value New flag value.
+   */
+  void setHandcuffed(int side, bool value) noexcept;
+
+  /**
+   * @brief Sets whether a player has used handcuffs this turn.
+   * @param side Player index.
+   * @param value New flag value.
+   */
+  void setUsedHandcuffsThisTurn(int side, bool value) noexcept;
+
+  /**
+   * @brief Records that a player knows the next shell.
+   * @param side Player index.
+   * @param shell The revealed shell.
+   */
+  void revealShell(int side, ShellType shell) noexcept;
+
+  /**
+   * @brief Forgets a player's knowledge of the next shell.
+   * @param side Player index.
+   */
+  void forgetShell(int side) noexcept;
+
+  /**
+   * @brief Sets whether the handsaw is applied.
+   * @param value New flag value.
+   */
+  void setSawActive(bool value) noexcept;
+
+  /**
+   * @brief Removes one shell of the given type from the magazine.
+   * @param shell The shell type drawn.
+   * @throws SimulationException If none of that type remain.
+   */
+  void removeShell(ShellType shell);
+
+  /**
+   * @brief Sets the side to move.
+   * @param value True for player one.
+   */
+  void setPlayerOneTurn(bool value) noexcept;
+
+  /**
+   * @brief Plays an action for the side to move, in place.
+   *
+   * Applies the same rules as the live game: shots and beer draw `shell`,
+   * the magnifying glass reveals it, items are consumed, and the turn passes
+   * or stays as the shot, blank or handcuffs dictate.  The action is
+   * validated before anything changes, so a throw leaves the state intact.
+   *
+   * @param action The action to play.
+   * @param shell The shell drawn or revealed (ignored by other items).
+   * @param undo Receives what is needed to revert the action.
+   * @throws SimulationException If the item or shell is not available.
+   */
+  void apply(Action action, ShellType shell, UndoRecord &undo);
+
+  /**
+   * @brief Reverts the action recorded by the matching apply().
+   *
+   * Undo records must be replayed in reverse order of application.
+   *
+   * @param undo The record filled in by apply().
+   */
+  void undo(const UndoRecord &undo) noexcept;
+};
+
+static_assert(std::is_trivially_copyable_v<SearchState>,
+              "SearchState must stay trivially copyable.");
+
+#endif // BUCKSHOT_ROULETTE_BOT_SEARCHSTATE_H
@@ -0,0 +1,21 @@
+#include "Search/SearchStats.h"
+
+uint64_t SearchCounters::totalCutoffs() const noexcept {
+  uint64_t total = 0;
+  for (uint64_t count : cutoffs)
+    total += count;
+  return total;
+}
+
+SearchCounters &
+SearchCounters::operator+=(const SearchCounters &other) noexcept {
+  leafEvaluations += other.leafEvaluations;
+  chanceNodes += other.chanceNodes;
+  chanceCutoffs += other.chanceCutoffs;
+  ttProbes += other.ttProbes;
+  ttHits += other.ttHits;
+  ttCutoffs += other.ttCutoffs;
+  for (int slot = 0; slot < CUTOFF_SLOTS; ++slot)
+    cutoffs[slot] += other.cutoffs[slot];
+  return *this;
+}
\ No newline at end of file
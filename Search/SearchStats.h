@@ -0,0 +1,80 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_SEARCHSTATS_H
+#define BUCKSHOT_ROULETTE_BOT_SEARCHSTATS_H
+
+#include "Player.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct SearchCounters
+ * @brief What a search did, counted per thread and summed when it ends.
+ *
+ * Each search thread counts into its own copy, so counting costs a local
+ * increment; the copies are added together once per thread.
+ */
+struct SearchCounters {
+  // Move positions whose cutoffs are counted separately.  No position
+  // offers more actions than this, so every slot is a single move index.
+  static constexpr int CUTOFF_SLOTS = 8;
+
+  uint64_t leafEvaluations = 0; ///< Positions scored by the heuristic.
+  uint64_t chanceNodes = 0;     ///< Actions searched under both shells.
+  uint64_t chanceCutoffs = 0;   ///< Chance nodes cut after the first shell.
+  uint64_t ttProbes = 0;        ///< Transposition table lookups.
+  uint64_t ttHits = 0;          ///< Lookups finding an entry deep enough.
+  uint64_t ttCutoffs = 0;       ///< Hits that settled the node outright.
+  uint64_t cutoffs[CUTOFF_SLOTS] = {}; ///< Cutoffs by the cutting move's index.
+
+  /**
+   * @brief Counts a cutoff.
+   * @param moveIndex Position of the refuting move in the node's order.
+   */
+  void recordCutoff(size_t moveIndex) noexcept {
+    ++cutoffs[moveIndex < CUTOFF_SLOTS ? moveIndex : CUTOFF_SLOTS - 1];
+  }
+
+  /**
+   * @brief Total alpha/beta cutoffs at every move index.
+   * @return The sum of the cutoff slots.
+   */
+  [[nodiscard]] uint64_t totalCutoffs() const noexcept;
+
+  /**
+   * @brief Adds another thread's or search's counts to these.
+   * @param other The counts to add.
+   * @return This object.
+   */
+  SearchCounters &operator+=(const SearchCounters &other) noexcept;
+};
+
+/**
+ * @struct SearchIteration
+ * @brief One depth of an iterative-deepening search.
+ */
+struct SearchIteration {
+  int depth = 0;          ///< Depth searched.
+  bool completed = false; ///< False if a limit cut it short.
+  uint64_t nodes = 0;     ///< Nodes searched during it, by every thread.
+  std::chrono::microseconds time{0}; ///< Wall-clock time it took.
+};
+
+/**
+ * @struct SearchStats
+ * @brief Everything counted during one of a bot's searches.
+ *
+ * The principal variation is the line the deepest completed depth
+ * expects: the chosen action, then the best reply after the likelier
+ * shell, and so on.  It is empty if nothing was searched.
+ */
+struct SearchStats {
+  uint64_t nodes = 0;      ///< Nodes searched, by every thread.
+  SearchCounters counters; ///< Event counts, by every thread.
+  int completedDepth = 0;  ///< Deepest completed depth; 0 if none.
+  std::vector<SearchIteration> iterations; ///< Depths tried, in order.
+  std::chrono::microseconds time{0};       ///< Wall-clock time of the move.
+  std::vector<Action> principalVariation;  ///< Expected line of play.
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_SEARCHSTATS_H
\ No newline at end of file
@@ -0,0 +1,519 @@
+#include "Tablebase.h"
+#include "BotPlayer.h"
+#include "Exceptions.h"
+#include "Zobrist.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+// Identifies a tablebase file.
+constexpr char FILE_MAGIC[4] = {'B', 'R', 'T', 'B'};
+// Bumped whenever the file layout or the indexing changes.
+constexpr uint32_t FILE_VERSION = 2;
+// Written natively; reads back differently on a foreign byte order.
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+// Sections start on page boundaries so each maps cleanly.
+constexpr uint64_t SECTION_ALIGNMENT = 4096;
+// Shell counts run from 0 to MAX_SHELLS for each type.
+constexpr int SHELL_BASE = Shotgun::MAX_SHELLS + 1;
+
+constexpr float UNKNOWN = std::numeric_limits<float>::quiet_NaN();
+
+struct FileHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint32_t sectionCount;
+};
+
+struct SectionEntry {
+  int32_t maxHealth;
+  int32_t maxItemsPerSide;
+  uint64_t entryCount;
+  uint64_t offset;
+};
+
+static_assert(sizeof(FileHeader) == 16, "FileHeader must not be padded.");
+static_assert(sizeof(SectionEntry) == 24, "SectionEntry must not be padded.");
+
+uint64_t alignUp(uint64_t offset) {
+  return (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT *
+         SECTION_ALIGNMENT;
+}
+
+bool validLimits(int maxHealth, int maxItemsPerSide) {
+  return maxHealth >= 1 && maxHealth < Zobrist::MAX_TRACKED_HEALTH &&
+         maxItemsPerSide >= 0 && maxItemsPerSide <= MAX_ITEMS;
+}
+} // namespace
+
+struct Tablebase::Mapping {
+  const char *data = nullptr; ///< Start of the file's contents.
+  size_t length = 0;          ///< File size in bytes.
+#ifdef _WIN32
+  std::vector<char> buffer;   ///< Contents read into memory.
+#endif
+
+  explicit Mapping(const std::string &path) {
+#ifdef _WIN32
+    // No mmap here; read the whole file instead.
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+      throw TablebaseException("Cannot open tablebase file: " + path);
+    }
+    buffer.resize(static_cast<size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!in) {
+      throw TablebaseException("Cannot read tablebase file: " + path);
+    }
+    data = buffer.data();
+    length = buffer.size();
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw TablebaseException("Cannot open tablebase file: " + path);
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+      ::close(fd);
+      throw TablebaseException("Cannot read tablebase file: " + path);
+    }
+    length = static_cast<size_t>(info.st_size);
+    void *address = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) {
+      throw TablebaseException("Cannot map tablebase file: " + path);
+    }
+    // Probes jump around the file; read-ahead would only waste memory.
+    ::madvise(address, length, MADV_RANDOM);
+    data = static_cast<const char *>(address);
+#endif
+  }
+
+  ~Mapping() {
+#ifndef _WIN32
+    ::munmap(const_cast<char *>(data), length);
+#endif
+  }
+
+  Mapping(const Mapping &) = delete;
+  Mapping &operator=(const Mapping &) = delete;
+};
+
+Tablebase::Section::Section(int maxHealthCap, int itemsPerSide)
+    : maxHealth(maxHealthCap), maxItemsPerSide(itemsPerSide) {
+  // Every way of holding at most maxItemsPerSide items, packed in base
+  // maxItemsPerSide + 1 (one digit per kind).
+  const int base = maxItemsPerSide + 1;
+  int packedLimit = 1;
+  for (int kind = 0; kind < ITEM_KIND_COUNT; ++kind)
+    packedLimit *= base;
+  itemRank.assign(static_cast<size_t>(packedLimit), -1);
+  for (int packed = 0; packed < packedLimit; ++packed) {
+    int total = 0;
+    for (int rest = packed; rest > 0; rest /= base)
+      total += rest % base;
+    if (total <= maxItemsPerSide) {
+      itemRank[static_cast<size_t>(packed)] =
+          static_cast<int>(itemCounts.size());
+      itemCounts.push_back(static_cast<uint32_t>(packed));
+    }
+  }
+
+  // Every non-empty magazine the shotgun can hold.
+  shellRank.assign(SHELL_BASE * SHELL_BASE, -1);
+  for (int live = 0; live < SHELL_BASE; ++live) {
+    for (int blank = 0; blank < SHELL_BASE; ++blank) {
+      const int total = live + blank;
+      if (total < 1 || total > Shotgun::MAX_SHELLS)
+        continue;
+      shellRank[static_cast<size_t>(live * SHELL_BASE + blank)] =
+          static_cast<int>(shellCounts.size());
+      shellCounts.push_back(static_cast<uint8_t>(live * SHELL_BASE + blank));
+    }
+  }
+}
+
+size_t Tablebase::Section::entryCount() const noexcept {
+  return static_cast<size_t>(maxHealth) * static_cast<size_t>(maxHealth) *
+         itemCounts.size() * itemCounts.size() * shellCounts.size() *
+         FLAG_COMBINATIONS;
+}
+
+const float *Tablebase::Section::values() const noexcept {
+  return mapped ? mapped : owned.data();
+}
+
+bool Tablebase::Section::coversMover(const SearchState &state) const noexcept {
+  const SearchState::Side &mover = state.players[SearchState::PLAYER_ONE];
+  const SearchState::Side &waiting = state.players[SearchState::PLAYER_TWO];
+
+  for (const auto &side : state.players) {
+    if (side.health < 1 || side.health > maxHealth)
+      return false;
+    int items = 0;
+    for (uint8_t count : side.items)
+      items += count;
+    if (items > maxItemsPerSide)
+      return false;
+  }
+
+  const int total = state.totalShells();
+  if (total < 1 || total > Shotgun::MAX_SHELLS)
+    return false;
+
+  // Only the waiting side can be cuffed, only the mover can have applied
+  // cuffs this turn, and only the mover can know the next shell.
+  if (mover.handcuffed || waiting.usedHandcuffsThisTurn ||
+      waiting.shellRevealed)
+    return false;
+  if (mover.usedHandcuffsThisTurn && !waiting.handcuffed)
+    return false;
+  if (mover.shellRevealed &&
+      (mover.knownShell == ShellType::LIVE_SHELL ? state.liveShells
+                                                  : state.blankShells) == 0)
+    return false;
+  return true;
+}
+
+size_t Tablebase::Section::indexOf(const SearchState &state) const noexcept {
+  const int base = maxItemsPerSide + 1;
+  auto itemIndex = [&](const SearchState::Side &side) {
+    int packed = 0;
+    for (int kind = ITEM_KIND_COUNT - 1; kind >= 0; --kind)
+      packed = packed * base + side.items[kind];
+    return static_cast<size_t>(itemRank[static_cast<size_t>(packed)]);
+  };
+
+  const SearchState::Side &mover = state.players[SearchState::PLAYER_ONE];
+  const SearchState::Side &waiting = state.players[SearchState::PLAYER_TWO];
+  const int cuffs =
+      waiting.handcuffed ? (mover.usedHandcuffsThisTurn ? 2 : 1) : 0;
+  const int reveal =
+      mover.shellRevealed
+          ? (mover.knownShell == ShellType::LIVE_SHELL ? 1 : 2)
+          : 0;
+  const int flags = (cuffs * 3 + reveal) * 2 + (state.sawActive ? 1 : 0);
+
+  const auto health = static_cast<size_t>(maxHealth);
+  const size_t itemCombos = itemCounts.size();
+  size_t index = static_cast<size_t>(mover.health - 1);
+  index = index * health + static_cast<size_t>(waiting.health - 1);
+  index = index * itemCombos + itemIndex(mover);
+  index = index * itemCombos + itemIndex(waiting);
+  index = index * shellCounts.size() +
+          static_cast<size_t>(shellRank[static_cast<size_t>(
+              state.liveShells * SHELL_BASE + state.blankShells)]);
+  return index * FLAG_COMBINATIONS + static_cast<size_t>(flags);
+}
+
+SearchState Tablebase::Section::stateAt(size_t index) const noexcept {
+  const auto base = static_cast<uint32_t>(maxItemsPerSide + 1);
+  auto setItems = [&](SearchState::Side &side, size_t rank) {
+    uint32_t packed = itemCounts[rank];
+    for (int kind = 0; kind < ITEM_KIND_COUNT; ++kind) {
+      side.items[kind] = static_cast<uint8_t>(packed % base);
+      packed /= base;
+    }
+  };
+
+  SearchState state{};
+  SearchState::Side &mover = state.players[SearchState::PLAYER_ONE];
+  SearchState::Side &waiting = state.players[SearchState::PLAYER_TWO];
+
+  const auto flags = static_cast<int>(index % FLAG_COMBINATIONS);
+  index /= FLAG_COMBINATIONS;
+  const uint8_t shells = shellCounts[index % shellCounts.size()];
+  index /= shellCounts.size();
+  setItems(waiting, index % itemCounts.size());
+  index /= itemCounts.size();
+  setItems(mover, index % itemCounts.size());
+  index /= itemCounts.size();
+  const auto health = static_cast<size_t>(maxHealth);
+  waiting.health = static_cast<int8_t>(index % health + 1);
+  mover.health = static_cast<int8_t>(index / health + 1);
+
+  state.liveShells = static_cast<uint8_t>(shells / SHELL_BASE);
+  state.blankShells = static_cast<uint8_t>(shells % SHELL_BASE);
+  state.sawActive = (flags % 2) == 1;
+  const int reveal = (flags / 2) % 3;
+  const int cuffs = flags / 6;
+  mover.shellRevealed = reveal != 0;
+  mover.knownShell =
+      reveal == 1 ? ShellType::LIVE_SHELL : ShellType::BLANK_SHELL;
+  waiting.handcuffed = cuffs != 0;
+  mover.usedHandcuffsThisTurn = cuffs == 2;
+  state.playerOneTurn = true;
+  state.maxHealth = static_cast<int8_t>(maxHealth);
+  state.hash = state.computeHash();
+  return state;
+}
+
+Tablebase Tablebase::generate(int maxHealth, int maxItemsPerSide) {
+  if (!validLimits(maxHealth, maxItemsPerSide)) {
+    throw InvalidGameArgumentException("Tablebase limits out of range.");
+  }
+
+  Tablebase table;
+  table.sections.emplace_back(maxHealth, maxItemsPerSide);
+  Section &section = table.sections.back();
+  const size_t entryCount = section.entryCount();
+  section.owned.assign(entryCount, UNKNOWN);
+
+  // Every action draws a shell or uses up an item, so successors always hold
+  // fewer shells plus items.  Solving in increasing order of that total means
+  // each successor is known before the positions that lead to it.
+  const int maxProgress = 2 * maxItemsPerSide + Shotgun::MAX_SHELLS;
+  std::vector<std::vector<uint32_t>> byProgress(
+      static_cast<size_t>(maxProgress + 1));
+  for (size_t index = 0; index < entryCount; ++index) {
+    const SearchState state = section.stateAt(index);
+    int progress = state.totalShells();
+    for (const auto &side : state.players)
+      for (uint8_t count : side.items)
+        progress += count;
+    byProgress[static_cast<size_t>(progress)].push_back(
+        static_cast<uint32_t>(index));
+  }
+
+  for (const auto &indices : byProgress) {
+    for (uint32_t index : indices) {
+      const SearchState state = section.stateAt(index);
+      if (!section.coversMover(state))
+        continue; // Knows a shell that is not in the magazine.
+
+      float best = -std::numeric_limits<float>::infinity();
+      for (Action action : BotPlayer::determineFeasibleActions(state)) {
+        float value;
+        if (table.actionValue(state, action, value))
+          best = std::max(best, value);
+      }
+      if (std::isfinite(best))
+        section.owned[index] = best;
+    }
+  }
+  return table;
+}
+
+Tablebase Tablebase::open(const std::string &path) {
+  auto mapping = std::make_shared<const Mapping>(path);
+
+  FileHeader header{};
+  if (mapping->length < sizeof(header)) {
+    throw TablebaseException("Not a tablebase file: " + path);
+  }
+  std::memcpy(&header, mapping->data, sizeof(header));
+  if (!std::equal(header.magic, header.magic + 4, FILE_MAGIC) ||
+      header.byteOrder != BYTE_ORDER_MARK) {
+    throw TablebaseException("Not a tablebase file: " + path);
+  }
+  if (header.version != FILE_VERSION) {
+    throw TablebaseException("Tablebase file has an unsupported version; "
+                             "regenerate it: " +
+                             path);
+  }
+
+  const uint64_t directoryEnd =
+      sizeof(header) + uint64_t{header.sectionCount} * sizeof(SectionEntry);
+  if (directoryEnd > mapping->length) {
+    throw TablebaseException("Tablebase file is truncated: " + path);
+  }
+
+  Tablebase table;
+  for (uint32_t i = 0; i < header.sectionCount; ++i) {
+    SectionEntry entry{};
+    std::memcpy(&entry,
+                mapping->data + sizeof(header) + i * sizeof(SectionEntry),
+                sizeof(entry));
+    if (!validLimits(entry.maxHealth, entry.maxItemsPerSide) ||
+        table.hasSection(entry.maxHealth)) {
+      throw TablebaseException("Tablebase section is invalid: " + path);
+    }
+
+    Section section(entry.maxHealth, entry.maxItemsPerSide);
+    if (entry.entryCount != section.entryCount() ||
+        entry.offset % SECTION_ALIGNMENT != 0 ||
+        entry.offset + entry.entryCount * sizeof(float) > mapping->length) {
+      throw TablebaseException("Tablebase section does not fit the file: " +
+                               path);
+    }
+    section.mapped =
+        reinterpret_cast<const float *>(mapping->data + entry.offset);
+    table.sections.push_back(std::move(section));
+  }
+  table.mappings.push_back(std::move(mapping));
+  return table;
+}
+
+std::shared_ptr<const Tablebase>
+Tablebase::openIfUsable(const std::string &path, std::ostream &warnings) {
+  if (!std::ifstream(path)) {
+    return nullptr;
+  }
+  try {
+    return std::make_shared<const Tablebase>(open(path));
+  } catch (const TablebaseException &e) {
+    warnings << "Warning: " << e.what() << "\n"
+             << "Continuing without the tablebase; regenerate it with "
+                "tablebase_gen.\n";
+    return nullptr;
+  }
+}
+
+void Tablebase::save(const std::string &path) const {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    throw TablebaseException("Cannot write tablebase file: " + path);
+  }
+
+  FileHeader header{};
+  std::copy(FILE_MAGIC, FILE_MAGIC + 4, header.magic);
+  header.version = FILE_VERSION;
+  header.byteOrder = BYTE_ORDER_MARK;
+  header.sectionCount = static_cast<uint32_t>(sections.size());
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  // Lay the sections out back to back, each on a page boundary.
+  uint64_t offset = alignUp(sizeof(header) +
+                            sections.size() * sizeof(SectionEntry));
+  std::vector<uint64_t> offsets;
+  for (const auto &section : sections) {
+    SectionEntry entry{};
+    entry.maxHealth = section.maxHealth;
+    entry.maxItemsPerSide = section.maxItemsPerSide;
+    entry.entryCount = section.entryCount();
+    entry.offset = offset;
+    out.write(reinterpret_cast<const char *>(&entry), sizeof(entry));
+    offsets.push_back(offset);
+    offset = alignUp(offset + entry.entryCount * sizeof(float));
+  }
+
+  for (size_t i = 0; i < sections.size(); ++i) {
+    const auto padding = offsets[i] - static_cast<uint64_t>(out.tellp());
+    const std::vector<char> zeros(static_cast<size_t>(padding), 0);
+    out.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+    out.write(reinterpret_cast<const char *>(sections[i].values()),
+              static_cast<std::streamsize>(sections[i].entryCount() *
+                                           sizeof(float)));
+  }
+  if (!out) {
+    throw TablebaseException("Failed writing tablebase file: " + path);
+  }
+}
+
+void Tablebase::addSections(Tablebase &&other) {
+  for (const auto &section : other.sections) {
+    if (hasSection(section.maxHealth)) {
+      throw InvalidGameArgumentException(
+          "Tablebase already has a section for that health cap.");
+    }
+  }
+  for (auto &section : other.sections)
+    sections.push_back(std::move(section));
+  for (auto &mapping : other.mappings)
+    mappings.push_back(std::move(mapping));
+  other.sections.clear();
+  other.mappings.clear();
+}
+
+bool Tablebase::covers(const SearchState &state) const noexcept {
+  const Section *section = sectionFor(state.maxHealth);
+  if (!section)
+    return false;
+  return state.playerOneTurn ? section->coversMover(state)
+                             : section->coversMover(state.mirrored());
+}
+
+bool Tablebase::probe(const SearchState &state, float &value) const {
+  if (!covers(state))
+    return false;
+  value = valueOf(state);
+  return !std::isnan(value);
+}
+
+bool Tablebase::actionValue(const SearchState &state, Action action,
+                            float &value) const {
+  if (!covers(state))
+    return false;
+
+  BotPlayer::ChanceOutcome outcomes[2];
+  const int count = BotPlayer::chanceOutcomes(state, action, outcomes);
+  float outcomeValues[2] = {0.0f, 0.0f};
+  for (int i = 0; i < count; ++i) {
+    SearchState next = state;
+    SearchState::UndoRecord undo;
+    try {
+      next.apply(action, outcomes[i].shell, undo);
+    } catch (const GameException &) {
+      return false;
+    }
+    outcomeValues[i] = valueOf(next);
+    if (std::isnan(outcomeValues[i]))
+      return false;
+  }
+
+  // Combined exactly as the search combines them.
+  value = count == 1 ? outcomeValues[0]
+                     : outcomes[0].probability * outcomeValues[0] +
+                           outcomes[1].probability * outcomeValues[1];
+  return true;
+}
+
+bool Tablebase::hasSection(int maxHealth) const noexcept {
+  return sectionFor(maxHealth) != nullptr;
+}
+
+int Tablebase::getMaxItemsPerSide(int maxHealth) const noexcept {
+  const Section *section = sectionFor(maxHealth);
+  return section ? section->maxItemsPerSide : -1;
+}
+
+size_t Tablebase::sectionCount() const noexcept { return sections.size(); }
+
+size_t Tablebase::size() const noexcept {
+  size_t total = 0;
+  for (const auto &section : sections)
+    total += section.entryCount();
+  return total;
+}
+
+const Tablebase::Section *
+Tablebase::sectionFor(int maxHealth) const noexcept {
+  for (const auto &section : sections)
+    if (section.maxHealth == maxHealth)
+      return &section;
+  return nullptr;
+}
+
+float Tablebase::valueOf(const SearchState &state) const {
+  // Deaths and empty magazines are scored as the search scores them.
+  if (state.players[SearchState::PLAYER_ONE].health <= 0 ||
+      state.players[SearchState::PLAYER_TWO].health <= 0 ||
+      state.totalShells() == 0)
+    return BotPlayer::evaluateState(state);
+
+  const Section *section = sectionFor(state.maxHealth);
+  if (!section)
+    return UNKNOWN;
+  if (state.playerOneTurn)
+    return section->coversMover(state)
+               ? section->values()[section->indexOf(state)]
+               : UNKNOWN;
+
+  // Stored with the mover as player one; mirror and negate.
+  const SearchState mirror = state.mirrored();
+  return section->coversMover(mirror)
+             ? -section->values()[section->indexOf(mirror)]
+             : UNKNOWN;
+}
@@ -0,0 +1,243 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_TABLEBASE_H
+#define BUCKSHOT_ROULETTE_BOT_TABLEBASE_H
+
+#include "Search/SearchState.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @class Tablebase
+ * @brief Exact values of every small position within one magazine.
+ *
+ * Covers positions where both players are alive, the magazine is not empty
+ * and each player holds at most a fixed number of items.  Every action
+ * either draws a shell or uses up an item, so a position's successors always
+ * hold fewer shells plus items; generate() solves positions in that order by
+ * backward induction, averaging chance outcomes by the live/blank counts.
+ * Positions at the end of the magazine are scored by
+ * BotPlayer::evaluateState(), just as the search scores them, so a probe
+ * returns what an unbounded expectiminimax search would.
+ *
+ * Positions are stored with the side to move as player one; evaluateState()
+ * is antisymmetric under swapping the players, so the other half of the
+ * state space is answered by mirroring and negating.
+ *
+ * A table holds one section per health cap.  On disk each section is a flat
+ * float array indexed directly by the position encoding, page-aligned after
+ * a small header and section directory:
+ *
+ *     header     magic "BRTB", version, byte-order mark, section count
+ *     directory  per section: max health, item limit, entry count, offset
+ *     sections   float[entry count] at each offset (native byte order)
+ *
+ * open() maps the file read-only instead of reading it, so only the pages
+ * a probe touches are loaded and processes sharing a file share its pages.
+ */
+class Tablebase {
+public:
+  // File the generator writes and the executables load by default.
+  static constexpr const char *DEFAULT_PATH = "tablebase.bin";
+  // Items each player may hold in a generated table unless told otherwise.
+  static constexpr int DEFAULT_MAX_ITEMS_PER_SIDE = 2;
+  // Status combinations stored per position: the waiting side's handcuffs
+  // (off, on, on and applied this turn) x the mover's shell knowledge
+  // (none, live, blank) x the handsaw.
+  static constexpr int FLAG_COMBINATIONS = 18;
+
+  /**
+   * @brief Creates a table with no sections; it covers nothing.
+   */
+  Tablebase() = default;
+
+  /**
+   * @brief Solves every covered position for one health cap.
+   * @param maxHealth Health cap the section is built for.
+   * @param maxItemsPerSide Most items either player may hold.
+   * @return A table with that single section.
+   * @throws InvalidGameArgumentException If either limit is out of range.
+   */
+  [[nodiscard]] static Tablebase
+  generate(int maxHealth, int maxItemsPerSide = DEFAULT_MAX_ITEMS_PER_SIDE);
+
+  /**
+   * @brief Maps a table written by save().
+   *
+   * Only the header and section directory are read; values are paged in as
+   * probes touch them.
+   *
+   * @param path File to open.
+   * @return The mapped table.
+   * @throws TablebaseException If the file is missing, truncated or not a
+   * tablebase of this version.
+   */
+  [[nodiscard]] static Tablebase open(const std::string &path);
+
+  /**
+   * @brief Maps the table a program starts with, if there is a usable one.
+   *
+   * A missing file means no table.  A file open() rejects, such as one from
+   * an older generator or one cut short, is reported on warnings with a hint
+   * to regenerate it, and the program carries on without a table.
+   *
+   * @param path File to open.
+   * @param warnings Stream a rejected file is reported on.
+   * @return The mapped table, or nullptr if there is none to use.
+   */
+  [[nodiscard]] static std::shared_ptr<const Tablebase>
+  openIfUsable(const std::string &path, std::ostream &warnings);
+
+  /**
+   * @brief Writes every section to a file.
+   * @param path File to write.
+   * @throws TablebaseException If the file cannot be written.
+   */
+  void save(const std::string &path) const;
+
+  /**
+   * @brief Moves another table's sections into this one.
+   * @param other The table to take sections from.
+   * @throws InvalidGameArgumentException If both tables have a section for
+   * the same health cap.
+   */
+  void addSections(Tablebase &&other);
+
+  /**
+   * @brief Checks whether a position is in the table.
+   * @param state The position, with either side to move.
+   * @return True if probe() can answer it.
+   */
+  [[nodiscard]] bool covers(const SearchState &state) const noexcept;
+
+  /**
+   * @brief Looks up a position's exact value.
+   * @param state The position, with either side to move.
+   * @param value Receives the value from player one's view.
+   * @return True if the position is covered.
+   */
+  [[nodiscard]] bool probe(const SearchState &state, float &value) const;
+
+  /**
+   * @brief Computes the exact expected value of playing an action.
+   * @param state A covered position.
+   * @param action The action for the side to move.
+   * @param value Receives the value from player one's view.
+   * @return True if the position is covered and the action can be played.
+   */
+  [[nodiscard]] bool actionValue(const SearchState &state, Action action,
+                                 float &value) const;
+
+  /**
+   * @brief Checks for a section built for a health cap.
+   * @param maxHealth The health cap.
+   * @return True if positions with that cap can be covered.
+   */
+  [[nodiscard]] bool hasSection(int maxHealth) const noexcept;
+
+  /**
+   * @brief Gets the item limit of a section.
+   * @param maxHealth The section's health cap.
+   * @return Item limit per side, or -1 if there is no such section.
+   */
+  [[nodiscard]] int getMaxItemsPerSide(int maxHealth) const noexcept;
+
+  /**
+   * @brief Gets the number of sections.
+   * @return Section count.
+   */
+  [[nodiscard]] size_t sectionCount() const noexcept;
+
+  /**
+   * @brief Gets the number of stored positions across all sections.
+   * @return Entry count.
+   */
+  [[nodiscard]] size_t size() const noexcept;
+
+private:
+  /**
+   * @struct Section
+   * @brief Positions for one health cap and item limit.
+   */
+  struct Section {
+    int maxHealth;                    ///< Health cap.
+    int maxItemsPerSide;              ///< Item limit per side.
+    std::vector<int> itemRank;        ///< Packed item counts -> rank, or -1.
+    std::vector<uint32_t> itemCounts; ///< Rank -> packed item counts.
+    std::vector<int> shellRank;       ///< live * 9 + blank -> rank, or -1.
+    std::vector<uint8_t> shellCounts; ///< Rank -> live * 9 + blank.
+    std::vector<float> owned;         ///< Values of a generated section.
+    const float *mapped = nullptr;    ///< Values inside an opened file.
+
+    /**
+     * @brief Builds the index tables for the given limits, with no values.
+     * @param maxHealthCap Health cap.
+     * @param itemsPerSide Item limit per side.
+     */
+    Section(int maxHealthCap, int itemsPerSide);
+
+    /**
+     * @brief Number of slots implied by the limits.
+     * @return Entry count.
+     */
+    [[nodiscard]] size_t entryCount() const noexcept;
+
+    /**
+     * @brief The stored values, mapped or owned.
+     * @return Pointer to entryCount() floats; NaN marks unreachable slots.
+     */
+    [[nodiscard]] const float *values() const noexcept;
+
+    /**
+     * @brief Checks coverage of a position with player one to move.
+     * @param state The position.
+     * @return True if it has a slot in this section.
+     */
+    [[nodiscard]] bool coversMover(const SearchState &state) const noexcept;
+
+    /**
+     * @brief Slot of a covered position with player one to move.
+     * @param state The position.
+     * @return Index into values().
+     */
+    [[nodiscard]] size_t indexOf(const SearchState &state) const noexcept;
+
+    /**
+     * @brief Rebuilds the position stored in a slot.
+     * @param index Index into values().
+     * @return The position, with player one to move.
+     */
+    [[nodiscard]] SearchState stateAt(size_t index) const noexcept;
+  };
+
+  /**
+   * @struct Mapping
+   * @brief Keeps an opened file mapped while any table uses it.
+   */
+  struct Mapping;
+
+  /**
+   * @brief Finds the section for a health cap.
+   * @param maxHealth The health cap.
+   * @return The section, or nullptr.
+   */
+  [[nodiscard]] const Section *sectionFor(int maxHealth) const noexcept;
+
+  /**
+   * @brief Value of any position reachable from a covered one.
+   *
+   * Deaths and empty magazines are scored directly; anything else is looked
+   * up, mirrored if player two is to move.
+   *
+   * @param state The position.
+   * @return The value from player one's view, or NaN if not covered.
+   */
+  [[nodiscard]] float valueOf(const SearchState &state) const;
+
+  std::vector<Section> sections;          ///< One per health cap.
+  std::vector<std::shared_ptr<const Mapping>> mappings; ///< Opened files.
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_TABLEBASE_H
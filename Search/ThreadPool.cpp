@@ -0,0 +1,52 @@
+#include "ThreadPool.h"
+#include "Exceptions.h"
+
+ThreadPool::ThreadPool(size_t threadCount) {
+  if (threadCount == 0) {
+    throw InvalidGameArgumentException(
+        "Thread pool must have at least one thread.");
+  }
+
+  workers.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; ++i)
+    workers.emplace_back([this] { workerLoop(); });
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  available.notify_all();
+  for (auto &worker : workers)
+    worker.join();
+}
+
+std::future<void> ThreadPool::submit(std::function<void()> task) {
+  std::packaged_task<void()> packaged(std::move(task));
+  std::future<void> result = packaged.get_future();
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks.push(std::move(packaged));
+  }
+  available.notify_one();
+  return result;
+}
+
+size_t ThreadPool::size() const noexcept { return workers.size(); }
+
+void ThreadPool::workerLoop() {
+  for (;;) {
+    std::packaged_task<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      available.wait(lock, [this] { return stopping || !tasks.empty(); });
+      if (tasks.empty())
+        return;
+      task = std::move(tasks.front());
+      tasks.pop();
+    }
+    // Exceptions are captured in the task's future.
+    task();
+  }
+}
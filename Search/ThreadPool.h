@@ -0,0 +1,64 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_THREADPOOL_H
+#define BUCKSHOT_ROULETTE_BOT_THREADPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads that run submitted tasks in FIFO order.
+ *
+ * Used by the bot to search root actions concurrently.  Workers start in the
+ * constructor and are joined in the destructor after the queue drains.
+ */
+class ThreadPool {
+public:
+  /**
+   * @brief Starts the workers.
+   * @param threadCount Number of worker threads.
+   * @throws InvalidGameArgumentException If threadCount is zero.
+   */
+  explicit ThreadPool(size_t threadCount);
+
+  /**
+   * @brief Finishes queued tasks and joins the workers.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /**
+   * @brief Queues a task for the next free worker.
+   * @param task The work to run.
+   * @return A future that becomes ready when the task finishes and rethrows
+   * anything it threw.
+   */
+  [[nodiscard]] std::future<void> submit(std::function<void()> task);
+
+  /**
+   * @brief Gets the number of worker threads.
+   * @return Worker count.
+   */
+  [[nodiscard]] size_t size() const noexcept;
+
+private:
+  /**
+   * @brief Runs queued tasks until the pool is shutting down and empty.
+   */
+  void workerLoop();
+
+  std::vector<std::thread> workers;              ///< Worker threads.
+  std::queue<std::packaged_task<void()>> tasks;  ///< Pending tasks.
+  std::mutex mutex;                              ///< Guards tasks/stopping.
+  std::condition_variable available;             ///< Signals new work.
+  bool stopping = false;                         ///< Set by the destructor.
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_THREADPOOL_H
@@ -0,0 +1,91 @@
+#include "TranspositionTable.h"
+#include "Exceptions.h"
+#include <cstring>
+
+namespace {
+// Packs everything but the key into one word.  Depth and best move are
+// stored off by one so an all-zero word decodes as an empty slot (depth -1,
+// no move).
+uint64_t pack(float value, int depth, BoundType bound, int bestMove,
+              uint8_t generation) noexcept {
+  uint32_t valueBits;
+  std::memcpy(&valueBits, &value, sizeof(valueBits));
+  return uint64_t{valueBits} |
+         (uint64_t{static_cast<uint16_t>(depth + 1)} << 32) |
+         (uint64_t{static_cast<uint8_t>(bound)} << 48) |
+         (uint64_t{static_cast<uint8_t>(bestMove + 1)} << 52) |
+         (uint64_t{generation} << 56);
+}
+
+TranspositionEntry unpack(uint64_t key, uint64_t data) noexcept {
+  TranspositionEntry entry;
+  const auto valueBits = static_cast<uint32_t>(data);
+  std::memcpy(&entry.value, &valueBits, sizeof(entry.value));
+  entry.key = key;
+  entry.depth = static_cast<int16_t>(static_cast<uint16_t>(data >> 32) - 1);
+  entry.bound =
+      static_cast<BoundType>(static_cast<uint8_t>((data >> 48) & 0xF));
+  entry.bestMove = static_cast<int8_t>(((data >> 52) & 0xF) - 1);
+  entry.generation = static_cast<uint8_t>(data >> 56);
+  return entry;
+}
+} // namespace
+
+TranspositionTable::TranspositionTable(size_t entryCount) {
+  if (entryCount == 0) {
+    throw InvalidGameArgumentException(
+        "Transposition table must have at least one entry.");
+  }
+
+  // Round down to a power of two so the index is a mask, not a modulo.
+  size_t count = 1;
+  while (count * 2 <= entryCount)
+    count *= 2;
+
+  slots = std::make_unique<Slot[]>(count);
+  slotCount = count;
+  indexMask = count - 1;
+}
+
+bool TranspositionTable::probe(uint64_t key,
+                               TranspositionEntry &entry) const noexcept {
+  const Slot &slot = slots[key & indexMask];
+  const uint64_t data = slot.data.load(std::memory_order_relaxed);
+  const uint64_t check = slot.check.load(std::memory_order_relaxed);
+  if (data == 0 || (check ^ data) != key)
+    return false;
+
+  entry = unpack(key, data);
+  return true;
+}
+
+void TranspositionTable::store(uint64_t key, float value, int depth,
+                               BoundType bound, int bestMove) noexcept {
+  Slot &slot = slots[key & indexMask];
+  const uint8_t current = generation.load(std::memory_order_relaxed);
+
+  // Within the current search, keep whichever result was searched deeper.
+  // Empty slots have depth -1, so they are always filled.
+  const TranspositionEntry existing =
+      unpack(0, slot.data.load(std::memory_order_relaxed));
+  if (existing.generation == current && existing.depth > depth)
+    return;
+
+  const uint64_t data = pack(value, depth, bound, bestMove, current);
+  slot.check.store(key ^ data, std::memory_order_relaxed);
+  slot.data.store(data, std::memory_order_relaxed);
+}
+
+void TranspositionTable::newSearch() noexcept {
+  generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TranspositionTable::clear() noexcept {
+  for (size_t i = 0; i < slotCount; ++i) {
+    slots[i].check.store(0, std::memory_order_relaxed);
+    slots[i].data.store(0, std::memory_order_relaxed);
+  }
+  generation.store(0, std::memory_order_relaxed);
+}
+
+size_t TranspositionTable::size() const noexcept { return slotCount; }
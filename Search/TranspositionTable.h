@@ -0,0 +1,115 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_TRANSPOSITIONTABLE_H
+#define BUCKSHOT_ROULETTE_BOT_TRANSPOSITIONTABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @enum class BoundType
+ * @brief Describes how a stored search value relates to the true value.
+ */
+enum class BoundType : uint8_t {
+  EXACT = 0, ///< The value is exact for the stored depth.
+  LOWER = 1, ///< The search failed high; the true value is at least this.
+  UPPER = 2  ///< The search failed low; the true value is at most this.
+};
+
+/**
+ * @struct TranspositionEntry
+ * @brief One cached search result.
+ */
+struct TranspositionEntry {
+  // Marks an entry with no stored best move.
+  static constexpr int NO_MOVE = -1;
+
+  uint64_t key = 0;                    ///< Full Zobrist key of the position.
+  float value = 0.0f;                  ///< Search value (player one's view).
+  int16_t depth = -1;                  ///< Remaining depth searched.
+  BoundType bound = BoundType::EXACT;  ///< How value bounds the true value.
+  uint8_t generation = 0;              ///< Search that wrote the entry.
+  int8_t bestMove = NO_MOVE;           ///< Best action found, as an int.
+};
+
+/**
+ * @class TranspositionTable
+ * @brief Fixed-size hash table of search results keyed by Zobrist hash.
+ *
+ * Each key maps to a single slot.  A slot is overwritten when it is empty,
+ * holds the same position, was written by an earlier search, or holds a
+ * result searched no deeper than the incoming one.
+ *
+ * probe() and store() may be called concurrently from search threads without
+ * locking.  Each slot keeps its packed data word and the key XORed with that
+ * word; a slot torn by two racing writers fails the key check and reads as a
+ * miss.  newSearch() and clear() must not overlap a search.
+ */
+class TranspositionTable {
+public:
+  // Default number of slots (16 bytes each, 16 MiB total).
+  static constexpr size_t DEFAULT_ENTRY_COUNT = size_t{1} << 20;
+
+  TranspositionTable(const TranspositionTable &) = delete;
+  TranspositionTable &operator=(const TranspositionTable &) = delete;
+
+  /**
+   * @brief Allocates an empty table.
+   * @param entryCount Number of slots, rounded down to a power of two.
+   */
+  explicit TranspositionTable(size_t entryCount = DEFAULT_ENTRY_COUNT);
+
+  /**
+   * @brief Looks up a position.
+   * @param key The position's Zobrist key.
+   * @param entry Receives the stored entry on a hit.
+   * @return True if the slot holds this position.
+   */
+  [[nodiscard]] bool probe(uint64_t key,
+                           TranspositionEntry &entry) const noexcept;
+
+  /**
+   * @brief Stores a search result, subject to the replacement scheme.
+   * @param key The position's Zobrist key.
+   * @param value The search value.
+   * @param depth The remaining depth that produced the value.
+   * @param bound How the value bounds the true value.
+   * @param bestMove The action that produced the value, as an int, or
+   * TranspositionEntry::NO_MOVE.
+   */
+  void store(uint64_t key, float value, int depth, BoundType bound,
+             int bestMove) noexcept;
+
+  /**
+   * @brief Marks the start of a new search so older entries age out first.
+   */
+  void newSearch() noexcept;
+
+  /**
+   * @brief Empties every slot.
+   */
+  void clear() noexcept;
+
+  /**
+   * @brief Gets the number of slots.
+   * @return Slot count.
+   */
+  [[nodiscard]] size_t size() const noexcept;
+
+private:
+  /**
+   * @struct Slot
+   * @brief Lock-free storage for one entry.
+   */
+  struct Slot {
+    std::atomic<uint64_t> check{0}; ///< Key XOR data.
+    std::atomic<uint64_t> data{0};  ///< Packed value, depth, bound, move, age.
+  };
+
+  std::unique_ptr<Slot[]> slots;          ///< Slot storage.
+  size_t slotCount;                       ///< Number of slots.
+  size_t indexMask;                       ///< size() - 1.
+  std::atomic<uint8_t> generation{0};     ///< Current search generation.
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_TRANSPOSITIONTABLE_H
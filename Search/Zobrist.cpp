@@ -0,0 +1,92 @@
+#include "Zobrist.h"
+#include <algorithm>
+
+namespace {
+// Fixed seed so hashes are identical across runs and builds.
+constexpr uint64_t ZOBRIST_SEED = 0x9E3779B97F4A7C15ULL;
+
+struct ZobristKeys {
+  uint64_t health[2][Zobrist::MAX_TRACKED_HEALTH];
+  uint64_t items[2][ITEM_KIND_COUNT][Zobrist::MAX_TRACKED_ITEMS];
+  uint64_t liveShells[Zobrist::MAX_TRACKED_SHELLS];
+  uint64_t blankShells[Zobrist::MAX_TRACKED_SHELLS];
+  uint64_t handcuffed[2];
+  uint64_t handcuffsUsed[2];
+  uint64_t revealed[2][2];
+  uint64_t saw;
+  uint64_t playerOneTurn;
+};
+
+// SplitMix64: small, well-distributed generator for filling the key tables.
+uint64_t nextKey(uint64_t &state) {
+  uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+const ZobristKeys &keys() {
+  static const ZobristKeys table = [] {
+    ZobristKeys k{};
+    uint64_t state = ZOBRIST_SEED;
+    for (auto &side : k.health)
+      for (auto &key : side)
+        key = nextKey(state);
+    for (auto &side : k.items)
+      for (auto &kind : side)
+        for (auto &key : kind)
+          key = nextKey(state);
+    for (auto &key : k.liveShells)
+      key = nextKey(state);
+    for (auto &key : k.blankShells)
+      key = nextKey(state);
+    for (auto &key : k.handcuffed)
+      key = nextKey(state);
+    for (auto &key : k.handcuffsUsed)
+      key = nextKey(state);
+    for (auto &side : k.revealed)
+      for (auto &key : side)
+        key = nextKey(state);
+    k.saw = nextKey(state);
+    k.playerOneTurn = nextKey(state);
+    return k;
+  }();
+  return table;
+}
+
+int clampIndex(int value, int size) { return std::clamp(value, 0, size - 1); }
+
+} // namespace
+
+uint64_t Zobrist::healthKey(int side, int health) noexcept {
+  return keys().health[side][clampIndex(health, MAX_TRACKED_HEALTH)];
+}
+
+uint64_t Zobrist::itemKey(int side, ItemKind kind, int count) noexcept {
+  return keys().items[side][static_cast<int>(kind)]
+                     [clampIndex(count, MAX_TRACKED_ITEMS)];
+}
+
+uint64_t Zobrist::liveShellKey(int count) noexcept {
+  return keys().liveShells[clampIndex(count, MAX_TRACKED_SHELLS)];
+}
+
+uint64_t Zobrist::blankShellKey(int count) noexcept {
+  return keys().blankShells[clampIndex(count, MAX_TRACKED_SHELLS)];
+}
+
+uint64_t Zobrist::handcuffedKey(int side) noexcept {
+  return keys().handcuffed[side];
+}
+
+uint64_t Zobrist::handcuffsUsedKey(int side) noexcept {
+  return keys().handcuffsUsed[side];
+}
+
+uint64_t Zobrist::revealedKey(int side, ShellType shell) noexcept {
+  return keys().revealed[side][static_cast<int>(shell)];
+}
+
+uint64_t Zobrist::sawKey() noexcept { return keys().saw; }
+
+uint64_t Zobrist::playerOneTurnKey() noexcept { return keys().playerOneTurn; }
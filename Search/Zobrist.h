@@ -0,0 +1,94 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_ZOBRIST_H
+#define BUCKSHOT_ROULETTE_BOT_ZOBRIST_H
+
+#include "Items/Item.h"
+#include "Shotgun.h"
+#include <cstdint>
+
+/**
+ * @class Zobrist
+ * @brief Random 64-bit keys used to hash search positions.
+ *
+ * A position's hash is the XOR of one key per feature (health, item counts,
+ * status flags, shell counts, saw state and side to move), so a single
+ * feature change updates the hash by XORing its old and new keys.  See
+ * SearchState for where the keys are combined.
+ * Index 0 refers to player one and index 1 to player two.
+ */
+class Zobrist {
+public:
+  // Health values at or above this share the last key.
+  static constexpr int MAX_TRACKED_HEALTH = 16;
+  // Number of distinct shell counts per shell type (0..MAX_SHELLS).
+  static constexpr int MAX_TRACKED_SHELLS = 9;
+  // Number of distinct per-kind item counts (0..MAX_ITEMS).
+  static constexpr int MAX_TRACKED_ITEMS = 9;
+
+  /**
+   * @brief Key for a player's health.
+   * @param side 0 for player one, 1 for player two.
+   * @param health The health value (clamped to the tracked range).
+   * @return The feature key.
+   */
+  [[nodiscard]] static uint64_t healthKey(int side, int health) noexcept;
+
+  /**
+   * @brief Key for how many items of one kind a player holds.
+   * @param side 0 for player one, 1 for player two.
+   * @param kind The item kind.
+   * @param count Number of items of that kind.
+   * @return The feature key.
+   */
+  [[nodiscard]] static uint64_t itemKey(int side, ItemKind kind,
+                                        int count) noexcept;
+
+  /**
+   * @brief Key for the number of live shells remaining.
+   * @param count Live shell count.
+   * @return The feature key.
+   */
+  [[nodiscard]] static uint64_t liveShellKey(int count) noexcept;
+
+  /**
+   * @brief Key for the number of blank shells remaining.
+   * @param count Blank shell count.
+   * @return The feature key.
+   */
+  [[nodiscard]] static uint64_t blankShellKey(int count) noexcept;
+
+  /**
+   * @brief Key for a player being handcuffed.
+   * @param side 0 for player one, 1 for player two.
+   * @return The feature key.
+   */
+  [[nodiscard]] static uint64_t handcuffedKey(int side) noexcept;
+
+  /**
+   * @brief Key for a player having used handcuffs this turn.
+   * @param side 0 for player one, 1 for player two.
+   * @return The feature key.
+   */
+  [[nodiscard]] static uint64_t handcuffsUsedKey(int side) noexcept;
+
+  /**
+   * @brief Key for a player knowing the next shell.
+   * @param side 0 for player one, 1 for player two.
+   * @param shell The revealed shell type.
+   * @return The feature key.
+   */
+  [[nodiscard]] static uint64_t revealedKey(int side, ShellType shell) noexcept;
+
+  /**
+   * @brief Key for the handsaw being applied to the shotgun.
+   * @return The feature key.
+   */
+  [[nodiscard]] static uint64_t sawKey() noexcept;
+
+  /**
+   * @brief Key for player one being the side to move.
+   * @return The feature key.
+   */
+  [[nodiscard]] static uint64_t playerOneTurnKey() noexcept;
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_ZOBRIST_H
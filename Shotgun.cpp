@@ -1,6 +1,5 @@
 #include "Shotgun.h"
 #include "Exceptions.h"
-#include <algorithm>
 #include <iostream>
 
 std::ostream &operator<<(std::ostream &os, const ShellType &shell) {
@@ -18,27 +17,72 @@ std::ostream &operator<<(std::ostream &os, const ShellType &shell) {
   return os;
 }
 
-void Shotgun::loadShells() {
-  static std::random_device rd;
-  static std::mt19937 gen(rd());
-  std::uniform_int_distribution<int> dist(MIN_SHELLS, MAX_SHELLS);
-
-  totalShells = dist(gen);
+namespace {
+// Most arrangements of a full load: choose(MAX_SHELLS, MAX_SHELLS / 2).
+constexpr int MAX_ARRANGEMENTS = 70;
+
+/**
+ * @brief Counts the live shells in a packed sequence.
+ * @param shells Shell bits.
+ * @return Number of set bits.
+ */
+constexpr int countLive(uint16_t shells) noexcept {
+  unsigned bits = shells;
+  bits = bits - ((bits >> 1) & 0x5555u);
+  bits = (bits & 0x3333u) + ((bits >> 2) & 0x3333u);
+  bits = (bits + (bits >> 4)) & 0x0F0Fu;
+  return static_cast<int>((bits + (bits >> 8)) & 0x1Fu);
+}
 
-  // Distribute shells evenly, with one extra live shell if odd number
-  if (totalShells % 2 == 0) {
-    liveShells = totalShells / 2;
-    blankShells = totalShells / 2;
-  } else {
-    liveShells = (totalShells / 2) + 1;
-    blankShells = totalShells / 2;
+/**
+ * @struct LoadArrangements
+ * @brief Every order a fresh load can come in, per magazine size.
+ *
+ * A load of n shells holds ceil(n / 2) live ones; masks[n] lists each n-bit
+ * sequence with that many bits set, so a uniform pick from it is a uniform
+ * shuffle.
+ */
+struct LoadArrangements {
+  uint16_t masks[Shotgun::MAX_SHELLS + 1][MAX_ARRANGEMENTS] = {};
+  int count[Shotgun::MAX_SHELLS + 1] = {};
+};
+
+/**
+ * @brief Enumerates the arrangements for every magazine size.
+ * @return The filled table.
+ */
+constexpr LoadArrangements buildArrangements() {
+  LoadArrangements table;
+  for (int total = Shotgun::MIN_SHELLS; total <= Shotgun::MAX_SHELLS;
+       ++total) {
+    const int live = (total + 1) / 2;
+    for (unsigned mask = 0; mask < (1u << total); ++mask) {
+      if (countLive(static_cast<uint16_t>(mask)) == live) {
+        table.masks[total][table.count[total]++] = static_cast<uint16_t>(mask);
+      }
+    }
   }
+  return table;
+}
+
+constexpr LoadArrangements LOAD_ARRANGEMENTS = buildArrangements();
+
+static_assert(LOAD_ARRANGEMENTS.count[Shotgun::MAX_SHELLS] <= MAX_ARRANGEMENTS,
+              "MAX_ARRANGEMENTS is too small for MAX_SHELLS.");
+} // namespace
+
+void Shotgun::loadShells() { loadShells(Random::threadEngine()); }
+
+void Shotgun::loadShells(Random::Engine &rng) {
+  std::uniform_int_distribution<int> dist(MIN_SHELLS, MAX_SHELLS);
+
+  totalShells = dist(rng);
 
-  // Create and shuffle the shells
-  loadedShells.clear();
-  loadedShells.resize(liveShells, ShellType::LIVE_SHELL);
-  loadedShells.resize(totalShells, ShellType::BLANK_SHELL);
-  std::shuffle(loadedShells.begin(), loadedShells.end(), gen);
+  // Pick one of the orders of ceil(total / 2) live shells uniformly, which
+  // shuffles the magazine in a single draw.
+  std::uniform_int_distribution<int> order(
+      0, LOAD_ARRANGEMENTS.count[totalShells] - 1);
+  loadedShells = LOAD_ARRANGEMENTS.masks[totalShells][order(rng)];
 }
 
 ShellType Shotgun::getNextShell() {
@@ -46,14 +90,8 @@ ShellType Shotgun::getNextShell() {
     throw EmptyShotgunException("The Shotgun is empty.");
   }
 
-  ShellType nextShell = loadedShells.front();
-  loadedShells.pop_front();
-
-  if (nextShell == ShellType::LIVE_SHELL) {
-    --liveShells;
-  } else {
-    --blankShells;
-  }
+  const auto nextShell = static_cast<ShellType>(loadedShells & 1u);
+  loadedShells = static_cast<uint16_t>(loadedShells >> 1);
   --totalShells;
 
   return nextShell;
@@ -63,27 +101,22 @@ ShellType Shotgun::revealNextShell() const {
   if (isEmpty()) {
     throw EmptyShotgunException("The Shotgun is empty.");
   }
-  return loadedShells.front();
+  return static_cast<ShellType>(loadedShells & 1u);
 }
 
-void Shotgun::rackShell() {
+ShellType Shotgun::rackShell() {
   if (isEmpty()) {
     throw EmptyShotgunException("The Shotgun is empty.");
   }
 
-  ShellType nextShell = loadedShells.front();
-  loadedShells.pop_front();
-
-  std::cout << "The racked shell is a " << nextShell << "." << std::endl;
-
-  if (nextShell == ShellType::LIVE_SHELL) {
-    --liveShells;
-  } else {
-    --blankShells;
-  }
+  const auto nextShell = static_cast<ShellType>(loadedShells & 1u);
+  loadedShells = static_cast<uint16_t>(loadedShells >> 1);
   --totalShells;
+  return nextShell;
 }
 
+uint16_t Shotgun::getShellBits() const noexcept { return loadedShells; }
+
 void Shotgun::useHandsaw() noexcept { sawUsed = true; }
 
 void Shotgun::resetSawUsed() noexcept { sawUsed = false; }
@@ -92,20 +125,24 @@ bool Shotgun::getSawUsed() const noexcept { return sawUsed; }
 
 bool Shotgun::isEmpty() const noexcept { return totalShells == 0; }
 
-int Shotgun::getLiveShellCount() const noexcept { return liveShells; }
+int Shotgun::getLiveShellCount() const noexcept {
+  return countLive(loadedShells);
+}
 
-int Shotgun::getBlankShellCount() const noexcept { return blankShells; }
+int Shotgun::getBlankShellCount() const noexcept {
+  return totalShells - countLive(loadedShells);
+}
 
 int Shotgun::getTotalShellCount() const noexcept { return totalShells; }
 
 float Shotgun::getLiveShellProbability() const noexcept {
-  return (totalShells > 0)
-             ? static_cast<float>(liveShells) / static_cast<float>(totalShells)
-             : 0.0f;
+  return (totalShells > 0) ? static_cast<float>(getLiveShellCount()) /
+                                static_cast<float>(totalShells)
+                          : 0.0f;
 }
 
 float Shotgun::getBlankShellProbability() const noexcept {
-  return (totalShells > 0)
-             ? static_cast<float>(blankShells) / static_cast<float>(totalShells)
-             : 0.0f;
+  return (totalShells > 0) ? static_cast<float>(getBlankShellCount()) /
+                                static_cast<float>(totalShells)
+                          : 0.0f;
 }
\ No newline at end of file
@@ -1,7 +1,8 @@
 #ifndef BUCKSHOT_ROULETTE_BOT_SHOTGUN_H
 #define BUCKSHOT_ROULETTE_BOT_SHOTGUN_H
 
-#include <deque>
+#include "Random.h"
+#include <cstdint>
 #include <ostream>
 #include <random>
 #include <string_view>
@@ -26,19 +27,24 @@ std::ostream &operator<<(std::ostream &os, const ShellType &shell);
 /**
  * @class Shotgun
  * @brief Manages shell loading, tracking, and probability calculations.
+ *
+ * The magazine is a packed bit sequence, one bit per shell (1 = live) with
+ * the next shell in bit 0, so drawing, revealing and racking are shifts and
+ * the live count is a popcount.  Reloading never allocates.
  */
 class Shotgun {
-protected:
+public:
   // Minimum total shells loaded per round.
   static constexpr int MIN_SHELLS = 2;
   // Maximum total shells loaded per round.
   static constexpr int MAX_SHELLS = 8;
 
-  int totalShells = 0;                ///< Total number of shells.
-  int liveShells = 0;                 ///< Live shells remaining.
-  int blankShells = 0;                ///< Blank shells remaining.
-  std::deque<ShellType> loadedShells; ///< Queue of loaded shells.
-  bool sawUsed = false;               ///< Indicates if the handsaw was used.
+  static_assert(MAX_SHELLS <= 16, "The magazine must fit in loadedShells.");
+
+protected:
+  int totalShells = 0;          ///< Total number of shells.
+  uint16_t loadedShells = 0;    ///< Shell bits, next in bit 0 (1 = live).
+  bool sawUsed = false;         ///< Indicates if the handsaw was used.
 
 public:
   /**
@@ -52,10 +58,16 @@ public:
   virtual ~Shotgun() = default;
 
   /**
-   * @brief Loads shells into the shotgun.
+   * @brief Loads shells into the shotgun using this thread's default engine.
    */
   void loadShells();
 
+  /**
+   * @brief Loads shells into the shotgun.
+   * @param rng Engine that picks the shell count and order.
+   */
+  void loadShells(Random::Engine &rng);
+
   /**
    * @brief Retrieves and removes the next shell.
    * @return The next shell type.
@@ -71,10 +83,11 @@ public:
   [[nodiscard]] ShellType revealNextShell() const;
 
   /**
-   * @brief Moves the current shell to the back.
+   * @brief Ejects the current shell without firing it.
+   * @return The ejected shell.
    * @throws std::runtime_error if the shotgun is empty.
    */
-  void rackShell();
+  ShellType rackShell();
 
   /**
    * @brief Uses the handsaw, modifying shotgun behavior.
@@ -110,6 +123,12 @@ public:
    */
   [[nodiscard]] int getBlankShellCount() const noexcept;
 
+  /**
+   * @brief Gets the shells left in firing order.
+   * @return One bit per shell, set for live, next shell in bit 0.
+   */
+  [[nodiscard]] uint16_t getShellBits() const noexcept;
+
   /**
    * @brief Gets the total shell count.
    * @return Total number of shells.
@@ -0,0 +1,203 @@
+#include "GameRecord.h"
+#include "Exceptions.h"
+#include "Game.h"
+#include <algorithm>
+#include <utility>
+
+namespace {
+/**
+ * @brief Appends an unsigned value in little-endian byte order.
+ * @param out Destination.
+ * @param value The value.
+ * @param bytes How many low-order bytes to write.
+ */
+void putLittleEndian(std::vector<uint8_t> &out, uint64_t value, int bytes) {
+  for (int byte = 0; byte < bytes; ++byte)
+    out.push_back(static_cast<uint8_t>(value >> (8 * byte)));
+}
+
+/**
+ * @brief Reads an unsigned little-endian value.
+ * @param in Source; at least `bytes` bytes.
+ * @param bytes How many bytes to read.
+ * @return The value.
+ */
+uint64_t getLittleEndian(const uint8_t *in, int bytes) {
+  uint64_t value = 0;
+  for (int byte = 0; byte < bytes; ++byte)
+    value |= static_cast<uint64_t>(in[byte]) << (8 * byte);
+  return value;
+}
+} // namespace
+
+GameRecorder::GameRecorder(GameEventSink *forwardTo) noexcept
+    : forward(forwardTo) {}
+
+void GameRecorder::onEvent(const GameEvent &event, const Game &game) {
+  const size_t offset = records.size();
+  records.resize(offset + BinaryEventSink::RECORD_SIZE);
+  BinaryEventSink::encode(event, records.data() + offset);
+  if (forward)
+    forward->onEvent(event, game);
+}
+
+std::vector<uint8_t> GameRecorder::frame(const Game &game, uint64_t index,
+                                         bool playerOneStarts) const {
+  const GameConfig &config = game.getConfig();
+  std::vector<uint8_t> bytes;
+  bytes.reserve(GameRecordWriter::FRAME_HEADER_SIZE + records.size());
+
+  putLittleEndian(bytes,
+                  GameRecordWriter::FRAME_HEADER_SIZE - 4 + records.size(), 4);
+  putLittleEndian(bytes, index, 8);
+  putLittleEndian(bytes, game.getSeed(), 8);
+  putLittleEndian(bytes, static_cast<uint64_t>(config.maxHealth), 1);
+  putLittleEndian(bytes, static_cast<uint64_t>(config.roundsToWin), 1);
+  putLittleEndian(bytes, static_cast<uint64_t>(config.minItemsPerRound), 1);
+  putLittleEndian(bytes, static_cast<uint64_t>(config.maxItemsPerRound), 1);
+  putLittleEndian(bytes, playerOneStarts ? 1 : 0, 1);
+  putLittleEndian(bytes, static_cast<uint64_t>(game.getPlayerOneWins()), 1);
+  putLittleEndian(bytes, static_cast<uint64_t>(game.getPlayerTwoWins()), 1);
+  putLittleEndian(bytes, 0, 1);
+  putLittleEndian(bytes, eventCount(), 4);
+  bytes.insert(bytes.end(), records.begin(), records.end());
+  return bytes;
+}
+
+size_t GameRecorder::eventCount() const noexcept {
+  return records.size() / BinaryEventSink::RECORD_SIZE;
+}
+
+GameRecordWriter::GameRecordWriter(const std::string &filePath)
+    : path(filePath), out(filePath, std::ios::binary | std::ios::trunc) {
+  if (!out) {
+    throw GameRecordException("Cannot write game record file: " + path);
+  }
+
+  std::vector<uint8_t> header(FILE_MAGIC, FILE_MAGIC + 4);
+  putLittleEndian(header, FILE_VERSION, 2);
+  putLittleEndian(header, BinaryEventSink::RECORD_SIZE, 2);
+  out.write(reinterpret_cast<const char *>(header.data()),
+            static_cast<std::streamsize>(header.size()));
+
+  writer = std::thread(&GameRecordWriter::run, this);
+}
+
+GameRecordWriter::~GameRecordWriter() {
+  try {
+    close();
+  } catch (const GameRecordException &) {
+    // Nothing can be reported from a destructor; call close() to find out.
+  }
+}
+
+void GameRecordWriter::submit(std::vector<uint8_t> frame) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (closing)
+      return;
+    queue.push_back(std::move(frame));
+  }
+  wake.notify_one();
+}
+
+void GameRecordWriter::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    closing = true;
+  }
+  wake.notify_one();
+  if (!writer.joinable())
+    return;
+
+  writer.join();
+  out.close();
+  if (out.fail()) {
+    throw GameRecordException("Failed writing game record file: " + path);
+  }
+}
+
+void GameRecordWriter::run() {
+  std::vector<std::vector<uint8_t>> batch;
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    wake.wait(lock, [this] { return closing || !queue.empty(); });
+    if (queue.empty())
+      break;
+
+    // Write outside the lock so submitters never wait on the disk.
+    batch.swap(queue);
+    lock.unlock();
+    for (const auto &frame : batch)
+      out.write(reinterpret_cast<const char *>(frame.data()),
+                static_cast<std::streamsize>(frame.size()));
+    batch.clear();
+    lock.lock();
+  }
+  out.flush();
+}
+
+GameRecordReader::GameRecordReader(const std::string &filePath)
+    : path(filePath), in(filePath, std::ios::binary) {
+  if (!in) {
+    throw GameRecordException("Cannot open game record file: " + path);
+  }
+
+  uint8_t header[GameRecordWriter::HEADER_SIZE];
+  if (!in.read(reinterpret_cast<char *>(header), sizeof header) ||
+      !std::equal(header, header + 4, GameRecordWriter::FILE_MAGIC) ||
+      getLittleEndian(header + 4, 2) != GameRecordWriter::FILE_VERSION ||
+      getLittleEndian(header + 6, 2) != BinaryEventSink::RECORD_SIZE) {
+    throw GameRecordException("Not a game record file of this version: " +
+                              path);
+  }
+}
+
+bool GameRecordReader::next(GameRecord &record) {
+  uint8_t prefix[4];
+  in.read(reinterpret_cast<char *>(prefix), sizeof prefix);
+  if (in.gcount() == 0 && in.eof())
+    return false;
+  if (!in) {
+    throw GameRecordException("Truncated frame in game record file: " + path);
+  }
+
+  const auto length = static_cast<size_t>(getLittleEndian(prefix, 4));
+  if (length < GameRecordWriter::FRAME_HEADER_SIZE - 4) {
+    throw GameRecordException("Malformed frame in game record file: " + path);
+  }
+  std::vector<uint8_t> bytes(length);
+  if (!in.read(reinterpret_cast<char *>(bytes.data()),
+               static_cast<std::streamsize>(length))) {
+    throw GameRecordException("Truncated frame in game record file: " + path);
+  }
+
+  const uint8_t *body = bytes.data();
+  const auto events = static_cast<size_t>(getLittleEndian(body + 24, 4));
+  if (length != GameRecordWriter::FRAME_HEADER_SIZE - 4 +
+                    events * BinaryEventSink::RECORD_SIZE) {
+    throw GameRecordException("Malformed frame in game record file: " + path);
+  }
+
+  record.index = getLittleEndian(body, 8);
+  record.seed = getLittleEndian(body + 8, 8);
+  record.config.maxHealth = body[16];
+  record.config.roundsToWin = body[17];
+  record.config.minItemsPerRound = body[18];
+  record.config.maxItemsPerRound = body[19];
+  record.playerOneStarts = body[20] != 0;
+  record.playerOneWins = body[21];
+  record.playerTwoWins = body[22];
+  record.events.clear();
+  record.events.reserve(events);
+  const uint8_t *event = body + GameRecordWriter::FRAME_HEADER_SIZE - 4;
+  for (size_t i = 0; i < events; ++i, event += BinaryEventSink::RECORD_SIZE) {
+    try {
+      record.events.push_back(BinaryEventSink::decode(event));
+    } catch (const InvalidGameArgumentException &) {
+      throw GameRecordException("Malformed event in game record file: " +
+                                path);
+    }
+  }
+  return true;
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_GAMERECORD_H
+#define BUCKSHOT_ROULETTE_BOT_GAMERECORD_H
+
+#include "GameConfig.h"
+#include "GameEventSink.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct GameRecord
+ * @brief Everything recorded about one finished game.
+ *
+ * The event list holds every item dealt, magazine loaded (with its shell
+ * order), action chosen (with the bot's search depth and value) and the
+ * events those actions caused, in the order the game emitted them.
+ */
+struct GameRecord {
+  uint64_t index = 0;            ///< Position of the game in its batch.
+  uint64_t seed = 0;             ///< Seed the game's engine was built from.
+  GameConfig config;             ///< Rules the game was played by.
+  bool playerOneStarts = true;   ///< Player one moved first.
+  int playerOneWins = 0;         ///< Rounds won by player one.
+  int playerTwoWins = 0;         ///< Rounds won by player two.
+  std::vector<GameEvent> events; ///< Everything that happened, in order.
+};
+
+/**
+ * @class GameRecorder
+ * @brief Event sink that keeps one game's events as encoded records.
+ *
+ * Attach it to a game, run the game, then call frame() to get the bytes the
+ * GameRecordWriter appends.  Encoding as events arrive keeps the per-event
+ * cost to a 16-byte append.
+ */
+class GameRecorder final : public GameEventSink {
+public:
+  /**
+   * @brief Creates an empty recorder.
+   * @param forward Sink that also receives every event, or nullptr.
+   */
+  explicit GameRecorder(GameEventSink *forward = nullptr) noexcept;
+
+  /**
+   * @brief Encodes the event and passes it on.
+   * @param event The event.
+   * @param game The game that emitted it.
+   */
+  void onEvent(const GameEvent &event, const Game &game) override;
+
+  /**
+   * @brief Builds the framed record of the game.
+   * @param game The finished game the recorder was attached to.
+   * @param index Position of the game in its batch.
+   * @param playerOneStarts Whether player one moved first.
+   * @return One frame of the game record format.
+   */
+  [[nodiscard]] std::vector<uint8_t> frame(const Game &game, uint64_t index,
+                                           bool playerOneStarts) const;
+
+  /**
+   * @brief Number of events recorded so far.
+   * @return Event count.
+   */
+  [[nodiscard]] size_t eventCount() const noexcept;
+
+private:
+  GameEventSink *forward;       ///< Also receives events (non-owning).
+  std::vector<uint8_t> records; ///< Encoded events, back to back.
+};
+
+/**
+ * @class GameRecordWriter
+ * @brief Appends game frames to a file on a background thread.
+ *
+ * A record file is an 8-byte header followed by one frame per game, all
+ * multi-byte fields little-endian:
+ *
+ *     header  magic "BRGR", u16 version, u16 event record size
+ *     frame   u32 length of the rest of the frame
+ *             u64 game index, u64 seed
+ *             u8 max health, rounds to win, min items, max items
+ *             u8 player one starts, player one wins, player two wins, 0
+ *             u32 event count, then that many BinaryEventSink records
+ *
+ * Frames appear in the order games finish, which with several simulate
+ * workers is not index order; the index in each frame identifies the game.
+ * The length prefix lets a reader skip a frame without decoding it.
+ *
+ * submit() only moves the frame into a queue, so game threads never wait on
+ * the disk.
+ */
+class GameRecordWriter {
+public:
+  // Identifies a game record file.
+  static constexpr char FILE_MAGIC[4] = {'B', 'R', 'G', 'R'};
+  // Bumped whenever the header, frame or event record layout changes.
+  static constexpr uint16_t FILE_VERSION = 1;
+  // Bytes of the file header.
+  static constexpr size_t HEADER_SIZE = 8;
+  // Bytes of a frame before its events, including the length prefix.
+  static constexpr size_t FRAME_HEADER_SIZE = 32;
+
+  /**
+   * @brief Creates the file, writes its header and starts the writer thread.
+   * @param path File to write; an existing file is replaced.
+   * @throws GameRecordException If the file cannot be created.
+   */
+  explicit GameRecordWriter(const std::string &path);
+
+  /**
+   * @brief Flushes every queued frame and stops the writer thread.
+   */
+  ~GameRecordWriter();
+
+  GameRecordWriter(const GameRecordWriter &) = delete;
+  GameRecordWriter &operator=(const GameRecordWriter &) = delete;
+
+  /**
+   * @brief Queues a frame to be appended.
+   *
+   * Safe to call from any number of threads.
+   *
+   * @param frame A frame from GameRecorder::frame().
+   */
+  void submit(std::vector<uint8_t> frame);
+
+  /**
+   * @brief Writes every queued frame, stops the thread and closes the file.
+   *
+   * Further submit() calls are ignored.  Calling close() again does nothing.
+   *
+   * @throws GameRecordException If any write failed.
+   */
+  void close();
+
+private:
+  /**
+   * @brief Writer thread: drains the queue until close() is called.
+   */
+  void run();
+
+  std::string path;                        ///< File being written.
+  std::ofstream out;                       ///< The file.
+  std::mutex mutex;                        ///< Guards the fields below.
+  std::condition_variable wake;            ///< Signals queued frames.
+  std::vector<std::vector<uint8_t>> queue; ///< Frames waiting to be written.
+  bool closing = false;                    ///< close() was called.
+  std::thread writer;                      ///< Runs run().
+};
+
+/**
+ * @class GameRecordReader
+ * @brief Reads the games of a record file one at a time.
+ */
+class GameRecordReader {
+public:
+  /**
+   * @brief Opens a record file and checks its header.
+   * @param path File to read.
+   * @throws GameRecordException If the file is missing or not a game record
+   * file of this version.
+   */
+  explicit GameRecordReader(const std::string &path);
+
+  /**
+   * @brief Reads the next game.
+   * @param record Receives the game.
+   * @return False once every game has been read.
+   * @throws GameRecordException If a frame is truncated or malformed.
+   */
+  [[nodiscard]] bool next(GameRecord &record);
+
+private:
+  std::string path; ///< File being read.
+  std::ifstream in; ///< The file.
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_GAMERECORD_H
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "HeadlessGame.h"
+#include "GameEventSink.h"
+
+HeadlessGame::HeadlessGame(Player *pOne, Player *pTwo, bool playerOneTurn)
+    : Game(pOne, pTwo, playerOneTurn) {
+  setEventSink(NullEventSink::instance());
+}
+
+HeadlessGame::HeadlessGame(Player *pOne, Player *pTwo, bool playerOneTurn,
+                           uint64_t gameSeed)
+    : Game(pOne, pTwo, playerOneTurn, gameSeed) {
+  setEventSink(NullEventSink::instance());
+}
+
+HeadlessGame::HeadlessGame(Player *pOne, Player *pTwo, bool playerOneTurn,
+                           uint64_t gameSeed, const GameConfig &gameConfig)
+    : Game(pOne, pTwo, playerOneTurn, gameSeed, gameConfig) {
+  setEventSink(NullEventSink::instance());
+}
+
+void HeadlessGame::setNarrated(bool narrate) noexcept { narrated = narrate; }
+
+void HeadlessGame::printShells() const {
+  if (narrated)
+    Game::printShells();
+}
+
+void HeadlessGame::pause(std::chrono::milliseconds /*delay*/) {}
+
+void HeadlessGame::showGameStart() {
+  if (narrated)
+    Game::showGameStart();
+}
+
+void HeadlessGame::showTurn(const Player &currentPlayer) {
+  if (narrated)
+    Game::showTurn(currentPlayer);
+}
+
+void HeadlessGame::showRoundStandings() {
+  if (narrated)
+    Game::showRoundStandings();
+}
+
+void HeadlessGame::showGameOver(const Player &winner) {
+  if (narrated)
+    Game::showGameOver(winner);
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_HEADLESSGAME_H
+#define BUCKSHOT_ROULETTE_BOT_HEADLESSGAME_H
+
+#include "Game.h"
+
+/**
+ * @class HeadlessGame
+ * @brief A real game with no pauses and no status display.
+ *
+ * Plays by exactly the same rules as Game but overrides every presentation
+ * hook with a no-op and reports events to NullEventSink::instance(), so
+ * bot-vs-bot batches run as fast as the bots can choose their moves.  A
+ * recording sink can still be attached with setEventSink(), and
+ * setNarrated() brings back Game's display for someone watching.
+ */
+class HeadlessGame : public Game {
+public:
+  /**
+   * @brief Initializes a silent game.
+   * @param p1 Pointer to player one.
+   * @param p2 Pointer to player two.
+   * @param isPlayerOneTurn Is it player one's turn?
+   */
+  HeadlessGame(Player *p1, Player *p2, bool isPlayerOneTurn);
+
+  /**
+   * @brief Initializes a silent game whose shells and items follow a seed.
+   * @param p1 Pointer to player one.
+   * @param p2 Pointer to player two.
+   * @param isPlayerOneTurn Is it player one's turn?
+   * @param seed Seed of the game's engine, e.g. Random::gameSeed().
+   */
+  HeadlessGame(Player *p1, Player *p2, bool isPlayerOneTurn, uint64_t seed);
+
+  /**
+   * @brief Initializes a silent seeded game with its own rules.
+   * @param p1 Pointer to player one.
+   * @param p2 Pointer to player two.
+   * @param isPlayerOneTurn Is it player one's turn?
+   * @param seed Seed of the game's engine, e.g. Random::gameSeed().
+   * @param config The rules.
+   * @throws InvalidGameArgumentException If the rules are invalid.
+   */
+  HeadlessGame(Player *p1, Player *p2, bool isPlayerOneTurn, uint64_t seed,
+               const GameConfig &config);
+
+  /**
+   * @brief Shows or hides Game's display; the game never pauses either way.
+   *
+   * Only the display hooks are affected: the events' own narration goes to
+   * whichever sink is attached with setEventSink().
+   *
+   * @param narrate Show the banner, turns, shell loads and standings.
+   */
+  void setNarrated(bool narrate) noexcept;
+
+  /**
+   * @brief Skips the shell summary unless narrated.
+   */
+  void printShells() const override;
+
+protected:
+  /**
+   * @brief Returns immediately.
+   * @param delay Ignored.
+   */
+  void pause(std::chrono::milliseconds delay) override;
+
+  /**
+   * @brief Skips the opening banner unless narrated.
+   */
+  void showGameStart() override;
+
+  /**
+   * @brief Skips the status display unless narrated.
+   * @param currentPlayer The player about to act.
+   */
+  void showTurn(const Player &currentPlayer) override;
+
+  /**
+   * @brief Skips the round standings unless narrated.
+   */
+  void showRoundStandings() override;
+
+  /**
+   * @brief Skips the match result unless narrated; read it from the win
+   * counts instead.
+   * @param winner The player who won the match.
+   */
+  void showGameOver(const Player &winner) override;
+
+private:
+  bool narrated = false; ///< Game's display hooks are shown.
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_HEADLESSGAME_H
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include "Replay.h"
+#include "Exceptions.h"
+#include "Simulations/HeadlessGame.h"
+#include <cmath>
+#include <string>
+
+namespace {
+/**
+ * @brief Checks whether two events describe the same thing.
+ *
+ * The search depth and value of a chosen action are what a replay compares,
+ * not what has to match, so they are ignored.
+ *
+ * @param a One event.
+ * @param b The other.
+ * @return True if they match.
+ */
+bool sameEvent(const GameEvent &a, const GameEvent &b) {
+  return a.type == b.type && a.seat == b.seat && a.target == b.target &&
+         a.item == b.item && a.shell == b.shell && a.live == b.live &&
+         a.blank == b.blank && a.hidden == b.hidden && a.action == b.action &&
+         a.shells == b.shells;
+}
+
+/**
+ * @class ReplayGame
+ * @brief A headless game that follows a record.
+ *
+ * It is its own event sink: each event the rules emit must be the next one
+ * in the record.  Players still choose at every turn, but the recorded
+ * action is played.
+ */
+class ReplayGame final : public HeadlessGame, private GameEventSink {
+public:
+  ReplayGame(Player *pOne, Player *pTwo, const GameRecord &gameRecord,
+             ReplayResult &replayResult)
+      : HeadlessGame(pOne, pTwo, gameRecord.playerOneStarts, gameRecord.seed,
+                     gameRecord.config),
+        record(gameRecord), result(replayResult) {
+    setEventSink(*this);
+  }
+
+  /**
+   * @brief Fails unless every recorded event was replayed.
+   * @throws ReplayDesyncException If the record has events left.
+   */
+  void checkFinished() const {
+    if (next != record.events.size())
+      throw ReplayDesyncException(
+          "game ended after " + std::to_string(next) + " of " +
+          std::to_string(record.events.size()) + " recorded events");
+  }
+
+protected:
+  Action requestAction(Player &currentPlayer) override {
+    const int seat = &currentPlayer == getPlayerOne() ? 0 : 1;
+    if (next >= record.events.size() ||
+        record.events[next].type != GameEventType::ACTION_CHOSEN ||
+        record.events[next].seat != seat)
+      throw ReplayDesyncException("player " + std::to_string(seat + 1) +
+                                  " moved where event " +
+                                  std::to_string(next) + " was expected");
+
+    const GameEvent &recorded = record.events[next];
+    const Action replayed = HeadlessGame::requestAction(currentPlayer);
+    if (replayed != recorded.action) {
+      ReplayDivergence divergence;
+      divergence.decision = result.decisions;
+      divergence.seat = seat;
+      divergence.recorded = recorded.action;
+      divergence.replayed = replayed;
+      divergence.recordedDepth = recorded.depth;
+      divergence.recordedValue = recorded.value;
+      if (auto *bot = dynamic_cast<BotPlayer *>(&currentPlayer)) {
+        divergence.replayedDepth = bot->getLastSearchDepth();
+        divergence.replayedValue = bot->getLastSearchValue();
+      } else {
+        divergence.replayedValue = std::nanf("");
+      }
+      result.divergences.push_back(divergence);
+    }
+    result.decisions++;
+    return recorded.action;
+  }
+
+private:
+  void onEvent(const GameEvent &event, const Game & /*game*/) override {
+    if (next >= record.events.size() ||
+        !sameEvent(event, record.events[next]))
+      throw ReplayDesyncException("event " + std::to_string(next) +
+                                  " differs from the record");
+    next++;
+  }
+
+  const GameRecord &record; ///< The game being replayed.
+  ReplayResult &result;     ///< Receives decisions and divergences.
+  size_t next = 0;          ///< Index of the next expected event.
+};
+} // namespace
+
+ReplayResult Replay::replayGame(const GameRecord &record,
+                                const BotSetup &setupBot) {
+  ReplayResult result;
+  result.gameIndex = record.index;
+
+  BotPlayer bot1("Bot1", record.config.maxHealth);
+  BotPlayer bot2("Bot2", record.config.maxHealth, &bot1);
+  bot1.setOpponent(&bot2);
+  if (setupBot) {
+    setupBot(bot1);
+    setupBot(bot2);
+  }
+
+  ReplayGame game(&bot1, &bot2, record, result);
+  try {
+    game.runGame();
+    game.checkFinished();
+  } catch (const ReplayDesyncException &e) {
+    result.desynced = true;
+    result.desyncReason = e.what();
+  }
+  return result;
+}
\ No newline at end of file
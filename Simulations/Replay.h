@@ -0,0 +1,73 @@
+#ifndef BUCKSHOT_ROULETTE_BOT_REPLAY_H
+#define BUCKSHOT_ROULETTE_BOT_REPLAY_H
+
+#include "BotPlayer.h"
+#include "Simulations/GameRecord.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ReplayDivergence
+ * @brief A recorded decision the replaying bot would have made differently.
+ */
+struct ReplayDivergence {
+  int decision = 0;        ///< Decision number within the game, from 0.
+  int seat = 0;            ///< Player who decided (0 or 1).
+  Action recorded{};       ///< Action in the record.
+  Action replayed{};       ///< Action the replaying bot chose.
+  int recordedDepth = 0;   ///< Depth the recorded choice was searched to.
+  int replayedDepth = 0;   ///< Depth the replaying bot searched to.
+  float recordedValue = 0; ///< Recorded value of the recorded action.
+  float replayedValue = 0; ///< Replaying bot's value of its action.
+};
+
+/**
+ * @struct ReplayResult
+ * @brief Outcome of replaying one recorded game.
+ */
+struct ReplayResult {
+  uint64_t gameIndex = 0;                    ///< Index of the game replayed.
+  int decisions = 0;                         ///< Decisions compared.
+  std::vector<ReplayDivergence> divergences; ///< Decisions that differed.
+  bool desynced = false; ///< The game stopped matching its record.
+  std::string desyncReason; ///< What stopped matching, if desynced.
+};
+
+/**
+ * @class Replay
+ * @brief Re-plays recorded games with fresh bots and compares decisions.
+ *
+ * A replay rebuilds the game from its recorded seed and rules, so the same
+ * shells are loaded and the same items dealt.  At every recorded decision
+ * the bot to move searches as usual; its choice is compared with the
+ * record, and then the recorded action is played regardless, so the game
+ * follows the recorded path and every decision in it is checked against
+ * the replaying bot.
+ *
+ * Every event the replay emits is checked against the record.  If one
+ * differs (the record came from other rules, say) the replay stops and the
+ * result is marked desynced; decisions from then on would not be
+ * comparable.
+ */
+class Replay {
+public:
+  /**
+   * @brief Adjusts a replaying bot before the game starts.
+   */
+  using BotSetup = std::function<void(BotPlayer &)>;
+
+  /**
+   * @brief Replays one recorded game.
+   * @param record The game.
+   * @param setupBot Applied to both bots, e.g. to set search threads or a
+   * tablebase; may be empty.
+   * @return Compared decisions and any divergences.
+   * @throws InvalidGameArgumentException If the recorded rules are invalid.
+   */
+  [[nodiscard]] static ReplayResult replayGame(const GameRecord &record,
+                                               const BotSetup &setupBot);
+};
+
+#endif // BUCKSHOT_ROULETTE_BOT_REPLAY_H
\ No newline at end of file
@@ -57,14 +57,20 @@ SimulatedGame::SimulatedGame(const SimulatedGame &other)
   this->playerOne->setOpponent(this->playerTwo);
   this->playerTwo->setOpponent(this->playerOne);
 
-  // Copy turn status
+  // Copy turn status and continue the same random stream
   this->isPlayerOneTurn = other.isPlayerOneTurnNow();
+  this->config = other.config;
+  this->seed = other.seed;
+  this->rng = other.rng;
 }
 
 SimulatedGame::SimulatedGame(SimulatedGame &&other) noexcept
-    : Game(other.playerOne, other.playerTwo, other.isPlayerOneTurn) {
-  // Move shotgun
+    : Game(other.playerOne, other.playerTwo, other.isPlayerOneTurn,
+           other.seed) {
+  // Move shotgun and random stream
   this->shotgun = std::move(other.shotgun);
+  this->config = other.config;
+  this->rng = other.rng;
 
   // Clear other's pointers
   other.playerOne = nullptr;
@@ -106,8 +112,11 @@ SimulatedGame &SimulatedGame::operator=(const SimulatedGame &other) {
     this->playerOne->setOpponent(this->playerTwo);
     this->playerTwo->setOpponent(this->playerOne);
 
-    // Copy turn status
+    // Copy turn status and continue the same random stream
     this->isPlayerOneTurn = other.isPlayerOneTurnNow();
+    this->config = other.config;
+    this->seed = other.seed;
+    this->rng = other.rng;
   }
   return *this;
 }
@@ -123,6 +132,9 @@ SimulatedGame &SimulatedGame::operator=(SimulatedGame &&other) noexcept {
     this->playerTwo = other.playerTwo;
     this->shotgun = std::move(other.shotgun);
     this->isPlayerOneTurn = other.isPlayerOneTurn;
+    this->config = other.config;
+    this->seed = other.seed;
+    this->rng = other.rng;
 
     // Clear other's pointers
     other.playerOne = nullptr;
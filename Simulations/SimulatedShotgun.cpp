@@ -7,10 +7,14 @@ SimulatedShotgun::SimulatedShotgun(int total, int live, int blank,
     throw InvalidGameArgumentException(
         "Total shells must equal live shells + blank shells");
   }
+  if (live < 0 || blank < 0 || total > MAX_SHELLS) {
+    throw InvalidGameArgumentException(
+        "Shell counts must be non-negative and fit in the magazine");
+  }
 
+  // Only the counts matter here, so keep the live shells in front.
   totalShells = total;
-  liveShells = live;
-  blankShells = blank;
+  loadedShells = static_cast<uint16_t>((1u << live) - 1u);
   sawUsed = isSawUsed;
 }
 
@@ -20,21 +24,22 @@ ShellType SimulatedShotgun::getNextShell() {
 }
 
 ShellType SimulatedShotgun::simulateLiveShell() {
-  if (liveShells <= 0) {
+  if (getLiveShellCount() <= 0) {
     throw SimulationException("No live shells available for simulation.");
   }
 
-  --liveShells;
+  // The live shells sit in front, so dropping the first keeps that layout.
+  loadedShells = static_cast<uint16_t>(loadedShells >> 1);
   --totalShells;
   return ShellType::LIVE_SHELL;
 }
 
 ShellType SimulatedShotgun::simulateBlankShell() {
-  if (blankShells <= 0) {
+  if (getBlankShellCount() <= 0) {
     throw SimulationException("No blank shells available for simulation.");
   }
 
-  --blankShells;
+  // Blanks sit behind the live shells; shortening the magazine drops one.
   --totalShells;
   return ShellType::BLANK_SHELL;
 }
\ No newline at end of file
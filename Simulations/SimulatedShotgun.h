@@ -7,7 +7,9 @@
  * @class SimulatedShotgun
  * @brief A non-interactive shotgun for game simulations.
  *
- * Overrides `getNextShell()` to prevent altering real game state.
+ * Overrides `getNextShell()` to prevent altering real game state.  Only the
+ * live/blank counts are known, so the magazine is kept in a canonical order
+ * with every live shell ahead of the blanks.
  */
 class SimulatedShotgun final : public Shotgun {
 public:
@@ -0,0 +1,343 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "BotPlayer.h"
+#include "GameEventSink.h"
+#include "Player.h"
+#include "Search/SearchLimits.h"
+#include "Search/SearchState.h"
+#include "Shotgun.h"
+#include "Simulations/HeadlessGame.h"
+#include "Simulations/SimulatedGame.h"
+#include "Simulations/SimulatedPlayer.h"
+#include "Simulations/SimulatedShotgun.h"
+
+namespace {
+
+// Seed of the magazine the performAction benchmarks fire from.
+constexpr uint64_t BENCHMARK_SEED = 17;
+
+/**
+ * @struct Position
+ * @brief A named position of the catalog, player one to move.
+ */
+struct Position {
+  const char *name;                    ///< Label shown in the results.
+  int maxHealth;                       ///< Health both players start with.
+  int playerOneHealth;                 ///< Player one's current health.
+  int playerTwoHealth;                 ///< Player two's current health.
+  std::vector<ItemKind> playerOneItems; ///< Player one's inventory.
+  std::vector<ItemKind> playerTwoItems; ///< Player two's inventory.
+  int live;                            ///< Live shells loaded.
+  int blank;                           ///< Blank shells loaded.
+  bool sawUsed;                        ///< A handsaw is active.
+};
+
+// Representative positions, from a fresh round down to a sawed endgame.
+const Position CATALOG[] = {
+    {"opening", 3, 3, 3,
+     {ItemKind::BEER, ItemKind::MAGNIFYING_GLASS, ItemKind::HANDCUFFS,
+      ItemKind::CIGARETTE},
+     {ItemKind::HANDSAW, ItemKind::BEER, ItemKind::MAGNIFYING_GLASS,
+      ItemKind::CIGARETTE},
+     4, 4, false},
+    {"midgame", 3, 3, 2,
+     {ItemKind::BEER, ItemKind::HANDSAW, ItemKind::HANDCUFFS,
+      ItemKind::MAGNIFYING_GLASS, ItemKind::CIGARETTE},
+     {ItemKind::BEER, ItemKind::MAGNIFYING_GLASS, ItemKind::HANDCUFFS},
+     4, 3, false},
+    {"item-heavy", 4, 4, 4,
+     {ItemKind::BEER, ItemKind::BEER, ItemKind::MAGNIFYING_GLASS,
+      ItemKind::MAGNIFYING_GLASS, ItemKind::HANDSAW, ItemKind::HANDCUFFS,
+      ItemKind::CIGARETTE, ItemKind::CIGARETTE},
+     {ItemKind::BEER, ItemKind::HANDSAW, ItemKind::HANDSAW,
+      ItemKind::HANDCUFFS, ItemKind::HANDCUFFS, ItemKind::MAGNIFYING_GLASS,
+      ItemKind::CIGARETTE, ItemKind::CIGARETTE},
+     3, 3, false},
+    {"endgame", 3, 1, 2,
+     {ItemKind::HANDSAW, ItemKind::MAGNIFYING_GLASS},
+     {ItemKind::BEER},
+     2, 1, false},
+    {"sawed", 2, 2, 2,
+     {ItemKind::MAGNIFYING_GLASS, ItemKind::BEER},
+     {ItemKind::HANDCUFFS, ItemKind::CIGARETTE},
+     1, 2, true},
+};
+
+// Number of positions in the catalog.
+constexpr int64_t CATALOG_SIZE = static_cast<int64_t>(std::size(CATALOG));
+
+// Catalog index of the midgame, which holds every item kind.
+constexpr int64_t MIDGAME = 1;
+
+/**
+ * @brief Gets a catalog position from a benchmark argument.
+ * @param index The argument.
+ * @return The position.
+ */
+const Position &positionAt(int64_t index) {
+  return CATALOG[static_cast<size_t>(index)];
+}
+
+/**
+ * @brief Gives a player a position's health and items.
+ * @param player The player, at full health.
+ * @param health The health to drop to.
+ * @param items The items to hand out.
+ */
+void equip(Player &player, int health, const std::vector<ItemKind> &items) {
+  while (player.getHealth() > health)
+    player.loseHealth(false);
+  for (ItemKind item : items)
+    (void)player.addItem(item);
+}
+
+/**
+ * @brief Builds a simulated game in a catalog position.
+ * @param position The position.
+ * @return The game, player one to move.
+ */
+SimulatedGame makeGame(const Position &position) {
+  auto *one = new SimulatedPlayer("P1", position.maxHealth);
+  auto *two = new SimulatedPlayer("P2", position.maxHealth, one);
+  one->setOpponent(two);
+  equip(*one, position.playerOneHealth, position.playerOneItems);
+  equip(*two, position.playerTwoHealth, position.playerTwoItems);
+  SimulatedGame game(one, two,
+                     new SimulatedShotgun(position.live + position.blank,
+                                          position.live, position.blank,
+                                          position.sawUsed),
+                     true);
+  game.setEventSink(NullEventSink::instance());
+  return game;
+}
+
+/**
+ * @brief Builds the search state of a catalog position.
+ * @param position The position.
+ * @return The state, player one to move.
+ */
+SearchState makeState(const Position &position) {
+  return SearchState::fromGame(makeGame(position));
+}
+
+/**
+ * @class ActionGame
+ * @brief A headless game that can be put back to its starting position.
+ *
+ * Shots need a real magazine, which a SimulatedGame does not have, so this
+ * fires from a seeded Shotgun and copies the players and magazine back
+ * before each action.  A restore is a few dozen bytes of copying and never
+ * allocates; BM_GameRestore measures it on its own.
+ */
+class ActionGame final : public HeadlessGame {
+public:
+  /**
+   * @brief Loads the magazine and remembers the starting position.
+   * @param one Player one, moving first.
+   * @param two Player two.
+   */
+  ActionGame(SimulatedPlayer &one, SimulatedPlayer &two)
+      : HeadlessGame(&one, &two, true, BENCHMARK_SEED), liveOne(one),
+        liveTwo(two), startOne(one), startTwo(two) {
+    loadShotgun();
+    startShotgun = *shotgun;
+  }
+
+  /**
+   * @brief Restores both players, the magazine and the turn.
+   */
+  void restore() {
+    liveOne = startOne;
+    liveTwo = startTwo;
+    *shotgun = startShotgun;
+    isPlayerOneTurn = true;
+  }
+
+private:
+  SimulatedPlayer &liveOne; ///< Player one as played.
+  SimulatedPlayer &liveTwo; ///< Player two as played.
+  SimulatedPlayer startOne; ///< Player one before any action.
+  SimulatedPlayer startTwo; ///< Player two before any action.
+  Shotgun startShotgun;     ///< The magazine before any action.
+};
+
+/**
+ * @brief Plays the ActionGame benchmarks from the midgame position.
+ * @param body Runs with the game; its timed loop is up to the caller.
+ */
+template <typename Body> void withActionGame(Body body) {
+  const Position &position = positionAt(MIDGAME);
+  SimulatedPlayer one("P1", position.maxHealth);
+  SimulatedPlayer two("P2", position.maxHealth, &one);
+  one.setOpponent(&two);
+  equip(one, position.playerOneHealth, position.playerOneItems);
+  equip(two, position.playerTwoHealth, position.playerTwoItems);
+  ActionGame game(one, two);
+  body(game);
+}
+
+// Every action, as benchmark arguments.
+const std::vector<int64_t> ALL_ACTIONS = {
+    static_cast<int64_t>(Action::SHOOT_SELF),
+    static_cast<int64_t>(Action::SHOOT_OPPONENT),
+    static_cast<int64_t>(Action::SMOKE_CIGARETTE),
+    static_cast<int64_t>(Action::USE_HANDCUFFS),
+    static_cast<int64_t>(Action::USE_MAGNIFYING_GLASS),
+    static_cast<int64_t>(Action::DRINK_BEER),
+    static_cast<int64_t>(Action::USE_HANDSAW)};
+
+} // namespace
+
+/**
+ * @brief Static evaluation of a catalog position.
+ */
+static void BM_EvaluateState(benchmark::State &state) {
+  const Position &position = positionAt(state.range(0));
+  const SearchState searchState = makeState(position);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(BotPlayer::evaluateState(searchState));
+  state.SetLabel(position.name);
+}
+BENCHMARK(BM_EvaluateState)->DenseRange(0, CATALOG_SIZE - 1);
+
+/**
+ * @brief Move generation for a catalog position.
+ */
+static void BM_DetermineFeasibleActions(benchmark::State &state) {
+  const Position &position = positionAt(state.range(0));
+  const SearchState searchState = makeState(position);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(BotPlayer::determineFeasibleActions(searchState));
+  state.SetLabel(position.name);
+}
+BENCHMARK(BM_DetermineFeasibleActions)->DenseRange(0, CATALOG_SIZE - 1);
+
+/**
+ * @brief Copy construction of a simulated game.
+ */
+static void BM_SimulatedGameCopy(benchmark::State &state) {
+  const Position &position = positionAt(state.range(0));
+  const SimulatedGame game = makeGame(position);
+  for (auto _ : state) {
+    SimulatedGame copy(game);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetLabel(position.name);
+}
+BENCHMARK(BM_SimulatedGameCopy)->DenseRange(0, CATALOG_SIZE - 1);
+
+/**
+ * @brief Game::performAction() for one action, midgame, restore included.
+ */
+static void BM_PerformAction(benchmark::State &state) {
+  const auto action = static_cast<Action>(state.range(0));
+  withActionGame([&](ActionGame &game) {
+    for (auto _ : state) {
+      game.restore();
+      benchmark::DoNotOptimize(game.performAction(action));
+    }
+  });
+  state.SetLabel(actionName(action));
+}
+BENCHMARK(BM_PerformAction)->ArgsProduct({ALL_ACTIONS});
+
+/**
+ * @brief The restore BM_PerformAction does before every action.
+ */
+static void BM_GameRestore(benchmark::State &state) {
+  withActionGame([&](ActionGame &game) {
+    for (auto _ : state) {
+      game.restore();
+      benchmark::ClobberMemory();
+    }
+  });
+}
+BENCHMARK(BM_GameRestore);
+
+/**
+ * @brief The search's own move: SearchState::apply() then undo().
+ */
+static void BM_ApplyUndo(benchmark::State &state) {
+  const auto action = static_cast<Action>(state.range(0));
+  const auto shell = static_cast<ShellType>(state.range(1));
+  SearchState searchState = makeState(positionAt(MIDGAME));
+  SearchState::UndoRecord undo{};
+  for (auto _ : state) {
+    searchState.apply(action, shell, undo);
+    benchmark::ClobberMemory();
+    searchState.undo(undo);
+  }
+  state.SetLabel(actionName(action));
+}
+BENCHMARK(BM_ApplyUndo)
+    ->ArgsProduct({ALL_ACTIONS,
+                   {static_cast<int64_t>(ShellType::LIVE_SHELL),
+                    static_cast<int64_t>(ShellType::BLANK_SHELL)}});
+
+/**
+ * @brief Fixed-depth expectiminimax from a cold transposition table.
+ */
+static void BM_ExpectiMiniMax(benchmark::State &state) {
+  const Position &position = positionAt(state.range(0));
+  const int depth = static_cast<int>(state.range(1));
+  const SearchState searchState = makeState(position);
+  BotPlayer bot("Bot", position.maxHealth);
+  for (auto _ : state) {
+    state.PauseTiming();
+    bot.clearTranspositionTable();
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(bot.searchToDepth(searchState, depth));
+  }
+  // Every cold search of the position does the same work.
+  const SearchStats &stats = bot.getLastSearchStats();
+  const auto nodes = static_cast<double>(stats.nodes);
+  state.counters["nodes"] = nodes;
+  state.counters["nodes/s"] =
+      benchmark::Counter(nodes, benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["cutoffs"] =
+      static_cast<double>(stats.counters.totalCutoffs());
+  state.SetLabel(position.name);
+}
+BENCHMARK(BM_ExpectiMiniMax)
+    ->ArgsProduct({benchmark::CreateDenseRange(0, CATALOG_SIZE - 1, 1),
+                   {2, 4, 6, 8}})
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief A whole chooseAction() from a cold transposition table.
+ *
+ * Deepening stops at a fixed node budget with no time limit, so every
+ * iteration does the same work whatever the machine's load.
+ */
+static void BM_ChooseAction(benchmark::State &state) {
+  const Position &position = positionAt(state.range(0));
+  BotPlayer bot("Bot", position.maxHealth);
+  SimulatedPlayer opponent("P2", position.maxHealth, &bot);
+  bot.setOpponent(&opponent);
+  equip(bot, position.playerOneHealth, position.playerOneItems);
+  equip(opponent, position.playerTwoHealth, position.playerTwoItems);
+  SimulatedShotgun shotgun(position.live + position.blank, position.live,
+                           position.blank, position.sawUsed);
+  SearchLimits limits;
+  limits.maxNodes = static_cast<uint64_t>(state.range(1));
+  limits.timeLimit = std::chrono::milliseconds{0};
+  bot.setSearchLimits(limits);
+  for (auto _ : state) {
+    state.PauseTiming();
+    bot.clearTranspositionTable();
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(bot.chooseAction(&shotgun));
+  }
+  const SearchStats &stats = bot.getLastSearchStats();
+  state.counters["nodes"] = static_cast<double>(stats.nodes);
+  state.counters["depth"] = stats.completedDepth;
+  state.SetLabel(position.name);
+}
+BENCHMARK(BM_ChooseAction)
+    ->ArgsProduct({benchmark::CreateDenseRange(0, CATALOG_SIZE - 1, 1),
+                   {100000}})
+    ->Unit(benchmark::kMillisecond);
\ No newline at end of file
@@ -1,6 +1,11 @@
 #include "BotPlayer.h"
 #include "Game.h"
 #include "HumanPlayer.h"
+#include "Search/Tablebase.h"
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <thread>
 
 // Starting hit points for each player at the beginning of every round.
 static constexpr int INITIAL_HEALTH = 3;
@@ -12,6 +17,14 @@ int main() {
   auto *dealer = new BotPlayer("Dealer", initialHealth, human);
   human->setOpponent(dealer);
 
+  // Let the dealer think on every core while the human waits.
+  dealer->setSearchThreads(
+      static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
+
+  // Play covered endgames straight from the tablebase if one was generated.
+  dealer->setTablebase(
+      Tablebase::openIfUsable(Tablebase::DEFAULT_PATH, std::cerr));
+
   Game game(human, dealer, true);
   game.runGame();
 
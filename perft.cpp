@@ -0,0 +1,95 @@
+#include "CommandLine.h"
+#include "Exceptions.h"
+#include "Player.h"
+#include "Search/Perft.h"
+#include "Search/SearchState.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Prints one row of node counts.
+ * @param label First column.
+ * @param counts The counts.
+ */
+static void printCounts(const std::string &label, const PerftCounts &counts) {
+  std::cout << std::left << std::setw(18) << label << std::right
+            << std::setw(14) << counts.decisionNodes << std::setw(14)
+            << counts.chanceNodes << std::setw(14) << counts.leafNodes
+            << std::setw(14) << counts.total();
+}
+
+int main(int argc, char *argv[]) {
+  int depth = -1;
+  std::string position;
+  bool divide = false;
+  bool verify = false;
+  try {
+    for (int i = 1; i < argc; i++) {
+      std::string arg = argv[i];
+      if (arg == "--divide") {
+        divide = true;
+      } else if (arg == "--verify") {
+        verify = true;
+      } else if (depth < 0) {
+        depth = CommandLine::parseNumber<int>(arg, 1);
+      } else {
+        // The position may be quoted as one argument or given field by field.
+        position += (position.empty() ? "" : " ") + arg;
+      }
+    }
+  } catch (const InvalidGameArgumentException &e) {
+    std::cerr << e.what() << "\n";
+    depth = -1;
+  }
+  if (depth < 1 || position.empty()) {
+    std::cerr << "Usage: perft DEPTH POSITION [--divide] [--verify]\n"
+                 "  e.g. perft 6 \"3 3/BCHSM/- 2/BHM/- 4/3 1 -\"\n";
+    return 1;
+  }
+
+  SearchState root;
+  try {
+    root = SearchState::fromString(position);
+  } catch (const InvalidGameArgumentException &e) {
+    std::cerr << e.what() << "\n";
+    return 1;
+  }
+
+  std::cout << "Position " << root.toString() << "\n";
+  std::cout << std::left << std::setw(18) << "depth" << std::right
+            << std::setw(14) << "decision" << std::setw(14) << "chance"
+            << std::setw(14) << "leaves" << std::setw(14) << "total"
+            << std::setw(12) << "ms" << std::setw(14) << "nodes/s" << "\n";
+  try {
+    // Shallower depths first: each row is cheap next to the last one and
+    // shows where the counts start to differ.
+    for (int d = 1; d <= depth; d++) {
+      const auto start = std::chrono::steady_clock::now();
+      const PerftCounts counts = Perft::count(root, d, verify);
+      const double seconds = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+      printCounts(std::to_string(d), counts);
+      std::cout << std::fixed << std::setprecision(1) << std::setw(12)
+                << seconds * 1000.0 << std::setprecision(0) << std::setw(14)
+                << (seconds > 0.0
+                        ? static_cast<double>(counts.total()) / seconds
+                        : 0.0)
+                << "\n";
+    }
+
+    if (divide) {
+      std::cout << "\nDivide at depth " << depth << ":\n";
+      for (const PerftDivision &division : Perft::divide(root, depth, verify)) {
+        printCounts(actionName(division.action), division.counts);
+        std::cout << "\n";
+      }
+    }
+  } catch (const SimulationException &e) {
+    std::cerr << e.what() << "\n";
+    return 2;
+  }
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include "BotPlayer.h"
+#include "CommandLine.h"
+#include "Exceptions.h"
+#include "Search/Tablebase.h"
+#include "Simulations/GameRecord.h"
+#include "Simulations/Replay.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct ReplayBatch
+ * @brief State shared by every replay worker.
+ */
+struct ReplayBatch {
+  GameRecordReader *reader = nullptr;         ///< Source of games.
+  std::mutex readerMutex;                     ///< Serialises reads.
+  std::mutex outputMutex;                     ///< Keeps report lines whole.
+  Replay::BotSetup setupBot;                  ///< Applied to every bot.
+  std::atomic<int> games{0};                  ///< Games replayed.
+  std::atomic<int> decisions{0};              ///< Decisions compared.
+  std::atomic<int> divergences{0};            ///< Decisions that differed.
+  std::atomic<int> desynced{0};               ///< Games that left the record.
+  std::atomic<bool> failed{false};            ///< The record was unreadable.
+};
+
+/**
+ * @brief Prints what a replayed game found.
+ * @param result The replay's result.
+ */
+static void report(const ReplayResult &result) {
+  for (const ReplayDivergence &d : result.divergences) {
+    std::cout << "game " << result.gameIndex << " decision " << d.decision
+              << " (player " << (d.seat + 1) << "): recorded "
+              << actionName(d.recorded) << " (depth " << d.recordedDepth
+              << ", value " << d.recordedValue << "), replayed "
+              << actionName(d.replayed) << " (depth " << d.replayedDepth
+              << ", value " << d.replayedValue << ")\n";
+  }
+  if (result.desynced) {
+    std::cout << "game " << result.gameIndex
+              << " desynced: " << result.desyncReason << "\n";
+  }
+}
+
+/**
+ * @brief Replays games from the shared reader until it runs dry.
+ * @param batch The batch.
+ */
+static void runWorker(ReplayBatch &batch) {
+  GameRecord record;
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(batch.readerMutex);
+      try {
+        if (batch.failed.load() || !batch.reader->next(record))
+          return;
+      } catch (const GameRecordException &e) {
+        std::cerr << e.what() << "\n";
+        batch.failed.store(true);
+        return;
+      }
+    }
+
+    const ReplayResult result = Replay::replayGame(record, batch.setupBot);
+    batch.games.fetch_add(1, std::memory_order_relaxed);
+    batch.decisions.fetch_add(result.decisions, std::memory_order_relaxed);
+    batch.divergences.fetch_add(static_cast<int>(result.divergences.size()),
+                                std::memory_order_relaxed);
+    if (result.desynced)
+      batch.desynced.fetch_add(1, std::memory_order_relaxed);
+
+    if (!result.divergences.empty() || result.desynced) {
+      std::lock_guard<std::mutex> lock(batch.outputMutex);
+      report(result);
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  std::string path;
+  int numThreads = 1;
+  int searchThreads = 1;
+  bool lazySmp = false;
+  bool useTablebase = true;
+  BotConfig botConfig;
+  std::vector<std::string> weights;
+  try {
+    for (int i = 1; i < argc; i++) {
+      std::string arg = argv[i];
+      if (arg == "--threads" && i + 1 < argc) {
+        numThreads = CommandLine::parseNumber<int>(argv[++i], 1);
+      } else if (arg == "--search-threads" && i + 1 < argc) {
+        searchThreads = CommandLine::parseNumber<int>(argv[++i], 1);
+      } else if (arg == "--lazy-smp") {
+        lazySmp = true;
+      } else if (arg == "--no-tablebase") {
+        useTablebase = false;
+      } else if (arg == "--nodes" && i + 1 < argc) {
+        botConfig.limits.maxNodes =
+            CommandLine::parseNumber<uint64_t>(argv[++i]);
+      } else if (arg == "--depth" && i + 1 < argc) {
+        botConfig.limits.maxDepth = CommandLine::parseNumber<int>(argv[++i]);
+      } else if (arg == "--time-ms" && i + 1 < argc) {
+        botConfig.limits.timeLimit = std::chrono::milliseconds{
+            CommandLine::parseNumber<long long>(argv[++i], 0)};
+      } else if (arg == "--min-depth" && i + 1 < argc) {
+        botConfig.minSearchDepth = CommandLine::parseNumber<int>(argv[++i]);
+      } else if (arg == "--weight" && i + 1 < argc) {
+        weights.emplace_back(argv[++i]);
+      } else if (path.empty()) {
+        path = arg;
+      } else {
+        path.clear();
+        break;
+      }
+    }
+    for (const auto &weight : weights)
+      botConfig.weights.assign(weight);
+    botConfig.validate();
+  } catch (const InvalidGameArgumentException &e) {
+    std::cerr << e.what() << "\n";
+    path.clear();
+  }
+  if (path.empty() || numThreads < 1 || searchThreads < 1) {
+    std::cerr << "Usage: replay FILE [--threads N] [--search-threads N] "
+                 "[--lazy-smp] [--no-tablebase] [--nodes N] [--depth D] "
+                 "[--time-ms T] [--min-depth D] [--weight NAME=VALUE]...\n";
+    return 1;
+  }
+
+  std::unique_ptr<GameRecordReader> reader;
+  try {
+    reader = std::make_unique<GameRecordReader>(path);
+  } catch (const GameRecordException &e) {
+    std::cerr << e.what() << "\n";
+    return 1;
+  }
+
+  // Every replaying bot shares the tablebase, if one was generated.
+  std::shared_ptr<const Tablebase> tablebase;
+  if (useTablebase) {
+    tablebase = Tablebase::openIfUsable(Tablebase::DEFAULT_PATH, std::cerr);
+  }
+
+  ReplayBatch batch;
+  batch.reader = reader.get();
+  batch.setupBot = [&](BotPlayer &bot) {
+    bot.setSearchThreads(searchThreads);
+    bot.setParallelSearchMode(lazySmp ? ParallelSearchMode::LAZY_SMP
+                                      : ParallelSearchMode::ROOT_SPLIT);
+    bot.setTablebase(tablebase);
+    bot.setConfig(botConfig);
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(static_cast<size_t>(numThreads - 1));
+  for (int t = 1; t < numThreads; t++)
+    workers.emplace_back(runWorker, std::ref(batch));
+  runWorker(batch);
+  for (auto &worker : workers)
+    worker.join();
+
+  std::cout << "Replayed " << batch.games.load() << " games: "
+            << batch.decisions.load() << " decisions, "
+            << batch.divergences.load() << " diverged, "
+            << batch.desynced.load() << " games desynced.\n";
+
+  if (batch.failed.load())
+    return 1;
+  // Nonzero on any difference, so the tool can drive a bisect.
+  return batch.divergences.load() > 0 || batch.desynced.load() > 0 ? 2 : 0;
+}
\ No newline at end of file
@@ -1,63 +1,386 @@
 #include "BotPlayer.h"
+#include "CommandLine.h"
+#include "Exceptions.h"
 #include "Game.h"
+#include "GameEventSink.h"
+#include "Random.h"
+#include "Search/SearchStats.h"
+#include "Search/Tablebase.h"
+#include "Simulations/GameRecord.h"
+#include "Simulations/HeadlessGame.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <iostream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
-static constexpr int INITIAL_HEALTH = 3;
 static constexpr int DEFAULT_NUM_GAMES = 1000;
+// Minimum time between two progress lines.
+static constexpr std::chrono::milliseconds PROGRESS_INTERVAL{250};
 
-int main(int argc, char *argv[]) {
-  int numGames = DEFAULT_NUM_GAMES;
-  bool verbose = false;
-  if (argc > 1) {
-    numGames = std::stoi(argv[1]);
+/**
+ * @struct SearchTotals
+ * @brief Search statistics summed over many moves.
+ */
+struct SearchTotals {
+  uint64_t moves = 0;      ///< Searched moves.
+  uint64_t nodes = 0;      ///< Nodes over every move.
+  uint64_t depthSum = 0;   ///< Completed depths, summed.
+  SearchCounters counters; ///< Event counts over every move.
+  std::chrono::microseconds time{0}; ///< Search time over every move.
+
+  /**
+   * @brief Adds one move's statistics.
+   * @param stats The move's statistics.
+   */
+  void add(const SearchStats &stats) {
+    moves++;
+    nodes += stats.nodes;
+    depthSum += static_cast<uint64_t>(stats.completedDepth);
+    counters += stats.counters;
+    time += stats.time;
   }
-  if (argc > 2 && std::string(argv[2]) == "-v") {
-    verbose = true;
+
+  /**
+   * @brief Adds another set of totals.
+   * @param other The totals to add.
+   */
+  void add(const SearchTotals &other) {
+    moves += other.moves;
+    nodes += other.nodes;
+    depthSum += other.depthSum;
+    counters += other.counters;
+    time += other.time;
   }
+};
 
-  // Suppress cout during simulation for speed
-  std::streambuf *origBuf = std::cout.rdbuf();
+/**
+ * @struct BatchState
+ * @brief Counters shared by every worker of a batch.
+ */
+struct BatchState {
+  int numGames = 0;                           ///< Games in the batch.
+  uint64_t masterSeed = 0;                    ///< Seed of the whole batch.
+  GameConfig config;                          ///< Rules of every game.
+  BotConfig bot1Config;                       ///< How Bot1 searches.
+  BotConfig bot2Config;                       ///< How Bot2 searches.
+  bool verbose = false;                       ///< Games are narrated.
+  std::shared_ptr<const Tablebase> tablebase; ///< Shared by all bots.
+  GameRecordWriter *recordWriter = nullptr;   ///< Records games, if set.
+  bool collectStats = false;                  ///< Search stats are summed.
+  std::mutex statsMutex;                      ///< Guards searchTotals.
+  SearchTotals searchTotals;                  ///< Both bots, every game.
+  std::atomic<int> nextGame{0};               ///< Next game index to claim.
+  std::atomic<int> gamesDone{0};              ///< Finished games.
+  std::atomic<int> bot1Wins{0};               ///< Games won by Bot1.
+  std::atomic<int> bot2Wins{0};               ///< Games won by Bot2.
+  std::atomic<int64_t> lastReport{0};         ///< Last progress line (ms).
+  std::chrono::steady_clock::time_point start; ///< When the batch started.
+};
 
-  int bot1Wins = 0;
-  int bot2Wins = 0;
+/**
+ * @struct BotOverrides
+ * @brief Command-line settings applied to both bots over their presets.
+ */
+struct BotOverrides {
+  std::optional<uint64_t> maxNodes;                   ///< --nodes
+  std::optional<int> maxDepth;                        ///< --depth
+  std::optional<std::chrono::milliseconds> timeLimit; ///< --time-ms
+  std::optional<int> minSearchDepth;                  ///< --min-depth
+  std::vector<std::string> weights;                   ///< --weight NAME=VALUE
+};
 
-  for (int i = 0; i < numGames; i++) {
-    // Reset maxHealth each game
-    Player::resetMaxHealth(0);
+/**
+ * @brief Builds one bot's configuration from its preset and the overrides.
+ * @param preset Name of the bot's preset.
+ * @param overrides Settings given for both bots.
+ * @return The validated configuration.
+ * @throws InvalidGameArgumentException If the preset, a weight or the
+ * resulting configuration is invalid.
+ */
+static BotConfig makeBotConfig(const std::string &preset,
+                               const BotOverrides &overrides) {
+  BotConfig botConfig = BotConfig::preset(preset);
+  if (overrides.maxNodes)
+    botConfig.limits.maxNodes = *overrides.maxNodes;
+  if (overrides.maxDepth)
+    botConfig.limits.maxDepth = *overrides.maxDepth;
+  if (overrides.timeLimit)
+    botConfig.limits.timeLimit = *overrides.timeLimit;
+  if (overrides.minSearchDepth)
+    botConfig.minSearchDepth = *overrides.minSearchDepth;
+  for (const auto &weight : overrides.weights)
+    botConfig.weights.assign(weight);
+  botConfig.validate();
+  return botConfig;
+}
 
-    auto *bot1 = new BotPlayer("Bot1", INITIAL_HEALTH);
-    auto *bot2 = new BotPlayer("Bot2", INITIAL_HEALTH, bot1);
-    bot1->setOpponent(bot2);
+/**
+ * @brief Plays one game of the batch on the calling thread.
+ *
+ * The worker's bots are reset first, transposition tables included, so
+ * every game plays the same whichever worker runs it and whatever it ran
+ * before.
+ *
+ * @param batch The batch.
+ * @param index The game's index; fixes its seed and who moves first.
+ * @param bot1 The worker's Bot1.
+ * @param bot2 The worker's Bot2.
+ */
+static void playGame(BatchState &batch, int index, BotPlayer &bot1,
+                     BotPlayer &bot2) {
+  for (BotPlayer *bot : {&bot1, &bot2}) {
+    bot->resetForNewGame();
+    bot->clearTranspositionTable();
+    bot->setSearchStatsCallback(nullptr);
+  }
+  // Summed locally and added to the batch once the game is over.
+  SearchTotals gameTotals;
+  if (batch.collectStats) {
+    auto addMove = [&gameTotals](const SearchStats &stats) {
+      gameTotals.add(stats);
+    };
+    bot1.setSearchStatsCallback(addMove);
+    bot2.setSearchStatsCallback(addMove);
+  }
 
-    // Suppress output during games unless verbose
-    if (!verbose)
-      std::cout.rdbuf(nullptr);
+  const uint64_t seed =
+      Random::gameSeed(batch.masterSeed, static_cast<uint64_t>(index));
+  const bool playerOneStarts = (index % 2 == 0);
+  HeadlessGame game(&bot1, &bot2, playerOneStarts, seed, batch.config);
+  game.setNarrated(batch.verbose);
+  GameEventSink *narrator =
+      batch.verbose ? &ConsoleEventSink::instance() : nullptr;
+  GameRecorder recorder(narrator);
+  if (batch.recordWriter)
+    game.setEventSink(recorder);
+  else if (narrator)
+    game.setEventSink(*narrator);
+  game.runGame();
 
-    Game game(bot1, bot2, (i % 2 == 0));
-    game.runGame();
+  if (batch.recordWriter)
+    batch.recordWriter->submit(recorder.frame(
+        game, static_cast<uint64_t>(index), playerOneStarts));
+  if (batch.collectStats) {
+    std::lock_guard<std::mutex> lock(batch.statsMutex);
+    batch.searchTotals.add(gameTotals);
+  }
 
-    // Restore output
-    if (!verbose)
-      std::cout.rdbuf(origBuf);
+  // Determine winner based on round win counts
+  if (game.getPlayerOneWins() > game.getPlayerTwoWins()) {
+    batch.bot1Wins.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    batch.bot2Wins.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief Prints a progress line unless one was printed very recently.
+ *
+ * Whichever worker claims the interval prints; the others skip it, so the
+ * line rate stays bounded however many games finish.
+ *
+ * @param batch The batch.
+ * @param gamesDone Games finished so far.
+ */
+static void reportProgress(BatchState &batch, int gamesDone) {
+  const int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - batch.start)
+                          .count();
+  // The last game always reports, so the final totals are shown.
+  if (gamesDone < batch.numGames) {
+    int64_t last = batch.lastReport.load(std::memory_order_relaxed);
+    if (now - last < PROGRESS_INTERVAL.count() ||
+        !batch.lastReport.compare_exchange_strong(last, now,
+                                                  std::memory_order_relaxed))
+      return;
+  }
 
-    // Determine winner based on round win counts
-    if (game.getPlayerOneWins() > game.getPlayerTwoWins()) {
-      bot1Wins++;
-    } else {
-      bot2Wins++;
+  std::cerr << "Game " << gamesDone << "/" << batch.numGames << " done. "
+            << "P1: " << batch.bot1Wins.load(std::memory_order_relaxed)
+            << " P2: " << batch.bot2Wins.load(std::memory_order_relaxed)
+            << "\r";
+}
+
+/**
+ * @brief Prints the search statistics of a batch.
+ * @param totals Both bots' statistics over every game.
+ */
+static void printSearchStats(const SearchTotals &totals) {
+  if (totals.moves == 0) {
+    std::cout << "No moves were searched.\n";
+    return;
+  }
+  const auto percent = [](uint64_t part, uint64_t whole) {
+    return whole == 0 ? 0.0
+                      : 100.0 * static_cast<double>(part) /
+                            static_cast<double>(whole);
+  };
+  const double seconds = static_cast<double>(totals.time.count()) / 1e6;
+  const SearchCounters &counters = totals.counters;
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "Searched moves: " << totals.moves << ", mean depth "
+            << static_cast<double>(totals.depthSum) /
+                   static_cast<double>(totals.moves)
+            << ", " << seconds << " s\n";
+  std::cout << "Nodes: " << totals.nodes << " ("
+            << (seconds > 0 ? static_cast<double>(totals.nodes) / seconds : 0)
+            << " per second), leaf evaluations: " << counters.leafEvaluations
+            << ", chance nodes: " << counters.chanceNodes << " ("
+            << percent(counters.chanceCutoffs, counters.chanceNodes)
+            << "% cut after one shell)\n";
+  std::cout << "TT probes: " << counters.ttProbes << ", hits "
+            << percent(counters.ttHits, counters.ttProbes) << "%, cutoffs "
+            << percent(counters.ttCutoffs, counters.ttProbes) << "%\n";
+  const uint64_t cutoffs = counters.totalCutoffs();
+  std::cout << "Alpha/beta cutoffs: " << cutoffs << "; by move index:";
+  for (int slot = 0; slot < SearchCounters::CUTOFF_SLOTS; ++slot)
+    std::cout << " " << percent(counters.cutoffs[slot], cutoffs) << "%";
+  std::cout << "\n" << std::defaultfloat;
+}
+
+/**
+ * @brief Claims and plays games until the batch is exhausted.
+ *
+ * The worker builds its two bots once, so their transposition tables are
+ * allocated once per worker rather than once per game.
+ *
+ * @param batch The batch.
+ */
+static void runWorker(BatchState &batch) {
+  BotPlayer bot1("Bot1", batch.config.maxHealth, nullptr, batch.bot1Config);
+  BotPlayer bot2("Bot2", batch.config.maxHealth, &bot1, batch.bot2Config);
+  bot1.setOpponent(&bot2);
+  bot1.setTablebase(batch.tablebase);
+  bot2.setTablebase(batch.tablebase);
+
+  int index;
+  while ((index = batch.nextGame.fetch_add(1, std::memory_order_relaxed)) <
+         batch.numGames) {
+    playGame(batch, index, bot1, bot2);
+    const int gamesDone =
+        batch.gamesDone.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (!batch.verbose)
+      reportProgress(batch, gamesDone);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  int numGames = DEFAULT_NUM_GAMES;
+  int numThreads = 1;
+  bool verbose = false;
+  bool collectStats = false;
+  GameConfig config;
+  std::string bot1Preset = "standard";
+  std::string bot2Preset = "standard";
+  BotOverrides overrides;
+  BotConfig bot1Config;
+  BotConfig bot2Config;
+  std::string recordPath;
+  // Game i is seeded from this and i, so a run can be repeated exactly.
+  uint64_t masterSeed = Random::randomSeed();
+  try {
+    for (int i = 1; i < argc; i++) {
+      std::string arg = argv[i];
+      if (arg == "-v") {
+        verbose = true;
+      } else if (arg == "--stats") {
+        collectStats = true;
+      } else if (arg == "--seed" && i + 1 < argc) {
+        masterSeed = CommandLine::parseNumber<uint64_t>(argv[++i]);
+      } else if (arg == "--health" && i + 1 < argc) {
+        config.maxHealth = CommandLine::parseNumber<int>(argv[++i]);
+      } else if (arg == "--record" && i + 1 < argc) {
+        recordPath = argv[++i];
+      } else if (arg == "--bot1" && i + 1 < argc) {
+        bot1Preset = argv[++i];
+      } else if (arg == "--bot2" && i + 1 < argc) {
+        bot2Preset = argv[++i];
+      } else if (arg == "--nodes" && i + 1 < argc) {
+        overrides.maxNodes = CommandLine::parseNumber<uint64_t>(argv[++i]);
+      } else if (arg == "--depth" && i + 1 < argc) {
+        overrides.maxDepth = CommandLine::parseNumber<int>(argv[++i]);
+      } else if (arg == "--time-ms" && i + 1 < argc) {
+        overrides.timeLimit = std::chrono::milliseconds{
+            CommandLine::parseNumber<long long>(argv[++i], 0)};
+      } else if (arg == "--min-depth" && i + 1 < argc) {
+        overrides.minSearchDepth = CommandLine::parseNumber<int>(argv[++i]);
+      } else if (arg == "--weight" && i + 1 < argc) {
+        overrides.weights.emplace_back(argv[++i]);
+      } else if (arg == "--threads" && i + 1 < argc) {
+        numThreads = CommandLine::parseNumber<int>(argv[++i], 1);
+      } else {
+        numGames = CommandLine::parseNumber<int>(arg, 1);
+      }
     }
+    config.validate();
+    bot1Config = makeBotConfig(bot1Preset, overrides);
+    bot2Config = makeBotConfig(bot2Preset, overrides);
+  } catch (const InvalidGameArgumentException &e) {
+    std::cerr << e.what() << "\n";
+    numGames = 0;
+  }
+  if (numGames < 1 || numThreads < 1) {
+    std::cerr << "Usage: simulate [numGames] [-v] [--stats] [--seed S] "
+                 "[--threads N] [--health H] [--record FILE] [--bot1 PRESET] "
+                 "[--bot2 PRESET] [--nodes N] [--depth D] [--time-ms T] "
+                 "[--min-depth D] [--weight NAME=VALUE]...\n";
+    return 1;
+  }
+
+  BatchState batch;
+  batch.numGames = numGames;
+  batch.masterSeed = masterSeed;
+  batch.config = config;
+  batch.bot1Config = bot1Config;
+  batch.bot2Config = bot2Config;
+  batch.verbose = verbose;
+  batch.collectStats = collectStats;
+  batch.start = std::chrono::steady_clock::now();
+
+  // Both bots share the tablebase, if one was generated.
+  batch.tablebase =
+      Tablebase::openIfUsable(Tablebase::DEFAULT_PATH, std::cerr);
 
-    if (!verbose) {
-      std::cerr << "Game " << (i + 1) << "/" << numGames << " done. "
-                << "P1: " << bot1Wins << " P2: " << bot2Wins << "\r";
+  // Games are framed on the workers and written by the recorder's thread.
+  std::unique_ptr<GameRecordWriter> recordWriter;
+  if (!recordPath.empty()) {
+    try {
+      recordWriter = std::make_unique<GameRecordWriter>(recordPath);
+    } catch (const GameRecordException &e) {
+      std::cerr << e.what() << "\n";
+      return 1;
     }
+    batch.recordWriter = recordWriter.get();
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(static_cast<size_t>(numThreads - 1));
+  for (int t = 1; t < numThreads; t++)
+    workers.emplace_back(runWorker, std::ref(batch));
+  runWorker(batch);
+  for (auto &worker : workers)
+    worker.join();
 
-    delete bot1;
-    delete bot2;
+  if (recordWriter) {
+    try {
+      recordWriter->close();
+    } catch (const GameRecordException &e) {
+      std::cerr << "\n" << e.what() << "\n";
+      return 1;
+    }
   }
 
-  std::cout << "\nResults after " << numGames << " games:\n";
+  const int bot1Wins = batch.bot1Wins.load();
+  const int bot2Wins = batch.bot2Wins.load();
+  std::cout << "\nResults after " << numGames << " games (seed "
+            << masterSeed << "):\n";
   std::cout << "Bot1 wins: " << bot1Wins << " ("
             << (100.0 * static_cast<double>(bot1Wins) /
                 static_cast<double>(numGames))
@@ -66,6 +389,8 @@ int main(int argc, char *argv[]) {
             << (100.0 * static_cast<double>(bot2Wins) /
                 static_cast<double>(numGames))
             << "%)\n";
+  if (collectStats)
+    printSearchStats(batch.searchTotals);
 
   return 0;
-}
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "Search/Tablebase.h"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static constexpr int INITIAL_HEALTH = 3;
+
+int main(int argc, char *argv[]) {
+  std::string path = Tablebase::DEFAULT_PATH;
+  std::vector<int> maxHealths = {INITIAL_HEALTH};
+  int maxItems = Tablebase::DEFAULT_MAX_ITEMS_PER_SIDE;
+  if (argc > 1) {
+    path = argv[1];
+  }
+  if (argc > 2) {
+    // One section per health cap, e.g. "2,3,4".
+    maxHealths.clear();
+    std::stringstream list(argv[2]);
+    std::string health;
+    while (std::getline(list, health, ','))
+      maxHealths.push_back(std::stoi(health));
+  }
+  if (argc > 3) {
+    maxItems = std::stoi(argv[3]);
+  }
+
+  Tablebase table;
+  for (int maxHealth : maxHealths) {
+    std::cout << "Solving positions with max health " << maxHealth
+              << " and up to " << maxItems << " items per side...\n";
+    auto startTime = std::chrono::steady_clock::now();
+    table.addSections(Tablebase::generate(maxHealth, maxItems));
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime);
+    std::cout << "  done in " << elapsed.count() << " ms.\n";
+  }
+
+  table.save(path);
+  std::cout << "Wrote " << table.size() << " positions in "
+            << table.sectionCount() << " section(s) to " << path << ".\n";
+
+  return 0;
+}
\ No newline at end of file
@@ -1,9 +1,25 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iterator>
 #include <gtest/gtest.h>
 #include <memory>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
+#include "BotConfig.h"
+#include "BotPlayer.h"
+#include "CommandLine.h"
 #include "Exceptions.h"
+#include "GameEventSink.h"
 #include "Items/Beer.h"
 #include "Items/Cigarette.h"
 #include "Items/Handcuffs.h"
@@ -11,18 +27,27 @@
 #include "Items/Item.h"
 #include "Items/MagnifyingGlass.h"
 #include "Player.h"
+#include "Random.h"
+#include "Search/ActionList.h"
+#include "Search/MoveOrdering.h"
+#include "Search/Perft.h"
+#include "Search/SearchState.h"
+#include "Search/Tablebase.h"
+#include "Search/ThreadPool.h"
+#include "Search/TranspositionTable.h"
+#include "Search/Zobrist.h"
 #include "Shotgun.h"
+#include "Simulations/GameRecord.h"
+#include "Simulations/HeadlessGame.h"
+#include "Simulations/Replay.h"
 #include "Simulations/SimulatedGame.h"
 #include "Simulations/SimulatedPlayer.h"
 #include "Simulations/SimulatedShotgun.h"
 
 // ============================================================
-// Fixture to reset static maxHealth between tests
+// Fixture shared by the player and game tests
 // ============================================================
-class PlayerTestFixture : public ::testing::Test {
-protected:
-  void SetUp() override { Player::resetMaxHealth(3); }
-};
+class PlayerTestFixture : public ::testing::Test {};
 
 // ============================================================
 // Shotgun Tests
@@ -162,6 +187,121 @@ TEST(ShotgunTest, ProbabilitySumsToOne) {
   EXPECT_FLOAT_EQ(sum, 1.0f);
 }
 
+TEST(ShotgunTest, DrawnShellsMatchLoadedCounts) {
+  Shotgun s;
+  for (int i = 0; i < 50; i++) {
+    s.loadShells();
+    int live = s.getLiveShellCount();
+    int blank = s.getBlankShellCount();
+    while (!s.isEmpty()) {
+      ShellType shell = s.getNextShell();
+      shell == ShellType::LIVE_SHELL ? --live : --blank;
+      EXPECT_EQ(s.getLiveShellCount(), live);
+      EXPECT_EQ(s.getBlankShellCount(), blank);
+    }
+    EXPECT_EQ(live, 0);
+    EXPECT_EQ(blank, 0);
+  }
+}
+
+TEST(ShotgunTest, LoadShellsShufflesOrder) {
+  Shotgun s;
+  bool sawLiveFirst = false;
+  bool sawBlankFirst = false;
+  for (int i = 0; i < 200 && !(sawLiveFirst && sawBlankFirst); i++) {
+    s.loadShells();
+    if (s.revealNextShell() == ShellType::LIVE_SHELL) {
+      sawLiveFirst = true;
+    } else {
+      sawBlankFirst = true;
+    }
+  }
+  EXPECT_TRUE(sawLiveFirst);
+  EXPECT_TRUE(sawBlankFirst);
+}
+
+TEST(ShotgunTest, LoadShellsFollowsEngine) {
+  Random::Engine first = Random::makeEngine(42);
+  Random::Engine second = Random::makeEngine(42);
+  Shotgun a;
+  Shotgun b;
+  for (int i = 0; i < 20; i++) {
+    a.loadShells(first);
+    b.loadShells(second);
+    ASSERT_EQ(a.getTotalShellCount(), b.getTotalShellCount());
+    while (!a.isEmpty()) {
+      EXPECT_EQ(a.getNextShell(), b.getNextShell());
+    }
+  }
+}
+
+// ============================================================
+// Random Tests
+// ============================================================
+
+TEST(RandomTest, GameSeedIsDeterministicAndDistinct) {
+  EXPECT_EQ(Random::gameSeed(7, 3), Random::gameSeed(7, 3));
+  EXPECT_NE(Random::gameSeed(7, 3), Random::gameSeed(7, 4));
+  EXPECT_NE(Random::gameSeed(7, 3), Random::gameSeed(8, 3));
+}
+
+TEST(RandomTest, MakeEngineUsesAllSeedBits) {
+  Random::Engine low = Random::makeEngine(1);
+  Random::Engine high = Random::makeEngine(1ull << 40);
+  Random::Engine again = Random::makeEngine(1);
+  EXPECT_NE(low(), high());
+  EXPECT_EQ(Random::makeEngine(1)(), again());
+}
+
+TEST(RandomTest, ThreadEnginesAreIndependent) {
+  Random::Engine *mainEngine = &Random::threadEngine();
+  Random::Engine *otherEngine = nullptr;
+  std::thread worker([&otherEngine] { otherEngine = &Random::threadEngine(); });
+  worker.join();
+  EXPECT_NE(mainEngine, otherEngine);
+}
+
+TEST_F(PlayerTestFixture, SeededGamesDealTheSameItems) {
+  SimulatedPlayer a1("A1", 3), a2("A2", 3), b1("B1", 3), b2("B2", 3);
+  Game first(&a1, &a2, true, Random::gameSeed(99, 0));
+  Game second(&b1, &b2, true, Random::gameSeed(99, 0));
+  EXPECT_EQ(first.getSeed(), second.getSeed());
+
+  first.distributeItems();
+  second.distributeItems();
+  ASSERT_EQ(a1.getItemCount(), b1.getItemCount());
+  ASSERT_EQ(a2.getItemCount(), b2.getItemCount());
+  for (int kind = 0; kind < ITEM_KIND_COUNT; kind++) {
+    EXPECT_EQ(a1.countItem(static_cast<ItemKind>(kind)),
+              b1.countItem(static_cast<ItemKind>(kind)));
+    EXPECT_EQ(a2.countItem(static_cast<ItemKind>(kind)),
+              b2.countItem(static_cast<ItemKind>(kind)));
+  }
+}
+
+// ============================================================
+// CommandLine Tests
+// ============================================================
+
+TEST(CommandLineTest, ParseNumberReadsWholeArguments) {
+  EXPECT_EQ(CommandLine::parseNumber<int>("42"), 42);
+  EXPECT_EQ(CommandLine::parseNumber<int>("-3"), -3);
+  EXPECT_EQ(CommandLine::parseNumber<uint64_t>("18446744073709551615"),
+            UINT64_MAX);
+  EXPECT_EQ(CommandLine::parseNumber<int>("1", 1), 1);
+
+  for (const char *text : {"", "abc", "12abc", " 12", "+12", "1.5",
+                           "99999999999"}) {
+    EXPECT_THROW((void)CommandLine::parseNumber<int>(text),
+                 InvalidGameArgumentException)
+        << text;
+  }
+  EXPECT_THROW((void)CommandLine::parseNumber<uint64_t>("-1"),
+               InvalidGameArgumentException);
+  EXPECT_THROW((void)CommandLine::parseNumber<int>("0", 1),
+               InvalidGameArgumentException);
+}
+
 // ============================================================
 // Player Tests (using SimulatedPlayer as concrete subclass)
 // ============================================================
@@ -237,6 +377,22 @@ TEST_F(PlayerTestFixture, ResetHealth) {
   EXPECT_EQ(p.getHealth(), 3);
 }
 
+TEST_F(PlayerTestFixture, ResetForNewGame) {
+  SimulatedPlayer p("Alice", 3);
+  p.loseHealth(false);
+  EXPECT_TRUE(p.addItem(std::make_unique<Cigarette>()));
+  p.applyHandcuffs();
+  p.useHandcuffsThisTurn();
+  p.setKnownNextShell(ShellType::LIVE_SHELL);
+  p.resetForNewGame();
+  EXPECT_EQ(p.getHealth(), 3);
+  EXPECT_EQ(p.getItemCount(), 0);
+  EXPECT_FALSE(p.hasItem("Cigarette"));
+  EXPECT_FALSE(p.areHandcuffsApplied());
+  EXPECT_FALSE(p.hasUsedHandcuffsThisTurn());
+  EXPECT_FALSE(p.isNextShellRevealed());
+}
+
 TEST_F(PlayerTestFixture, HandcuffsState) {
   SimulatedPlayer p("Alice", 3);
   EXPECT_FALSE(p.areHandcuffsApplied());
@@ -361,6 +517,49 @@ TEST_F(PlayerTestFixture, GetItemsView) {
   EXPECT_EQ(items[1]->getName(), "Beer");
 }
 
+TEST_F(PlayerTestFixture, ItemKindInventory) {
+  SimulatedPlayer p("Alice", 3);
+  EXPECT_TRUE(p.addItem(ItemKind::BEER));
+  EXPECT_TRUE(p.addItem(ItemKind::HANDSAW));
+  EXPECT_TRUE(p.addItem(ItemKind::BEER));
+
+  EXPECT_TRUE(p.hasItem(ItemKind::BEER));
+  EXPECT_FALSE(p.hasItem(ItemKind::CIGARETTE));
+  EXPECT_EQ(p.countItem(ItemKind::BEER), 2);
+  EXPECT_EQ(p.countItem("Beer"), 2);
+
+  EXPECT_TRUE(p.removeItem(ItemKind::BEER));
+  EXPECT_FALSE(p.removeItem(ItemKind::CIGARETTE));
+  EXPECT_EQ(p.countItem(ItemKind::BEER), 1);
+
+  // The remaining items keep their pickup order.
+  auto items = p.getItemsView();
+  ASSERT_EQ(items.size(), 2u);
+  EXPECT_EQ(items[0]->getKind(), ItemKind::HANDSAW);
+  EXPECT_EQ(items[1]->getKind(), ItemKind::BEER);
+}
+
+TEST_F(PlayerTestFixture, UseItemByKind) {
+  SimulatedPlayer p("Alice", 3);
+  p.loseHealth(false);
+  p.addItem(ItemKind::CIGARETTE);
+
+  EXPECT_FALSE(p.useItem(ItemKind::BEER));
+  EXPECT_TRUE(p.useItem(ItemKind::CIGARETTE));
+  EXPECT_EQ(p.getHealth(), 3);
+  EXPECT_EQ(p.getItemCount(), 0);
+  EXPECT_FALSE(p.hasItem(ItemKind::CIGARETTE));
+}
+
+TEST_F(PlayerTestFixture, AddItemByKindMaxCapacity) {
+  SimulatedPlayer p("Alice", 3);
+  for (int i = 0; i < MAX_ITEMS; i++) {
+    EXPECT_TRUE(p.addItem(ItemKind::HANDCUFFS));
+  }
+  EXPECT_FALSE(p.addItem(ItemKind::HANDCUFFS));
+  EXPECT_EQ(p.countItem(ItemKind::HANDCUFFS), MAX_ITEMS);
+}
+
 TEST_F(PlayerTestFixture, SetOpponent) {
   SimulatedPlayer p1("Alice", 3);
   SimulatedPlayer p2("Bob", 3);
@@ -408,6 +607,30 @@ TEST(ItemTest, CreateByNameInvalid) {
   EXPECT_EQ(empty, nullptr);
 }
 
+TEST(ItemTest, GetKindMatchesType) {
+  EXPECT_EQ(Beer().getKind(), ItemKind::BEER);
+  EXPECT_EQ(Cigarette().getKind(), ItemKind::CIGARETTE);
+  EXPECT_EQ(Handcuffs().getKind(), ItemKind::HANDCUFFS);
+  EXPECT_EQ(Handsaw().getKind(), ItemKind::HANDSAW);
+  EXPECT_EQ(MagnifyingGlass().getKind(), ItemKind::MAGNIFYING_GLASS);
+}
+
+TEST(ItemTest, ForKindReturnsSharedInstance) {
+  for (int i = 0; i < ITEM_KIND_COUNT; i++) {
+    auto kind = static_cast<ItemKind>(i);
+    EXPECT_EQ(Item::forKind(kind).getKind(), kind);
+    EXPECT_EQ(&Item::forKind(kind), &Item::forKind(kind));
+  }
+}
+
+TEST(ItemTest, KindFromName) {
+  ItemKind kind = ItemKind::BEER;
+  EXPECT_TRUE(Item::kindFromName("Magnifying Glass", kind));
+  EXPECT_EQ(kind, ItemKind::MAGNIFYING_GLASS);
+  EXPECT_FALSE(Item::kindFromName("InvalidItem", kind));
+  EXPECT_EQ(kind, ItemKind::MAGNIFYING_GLASS);
+}
+
 TEST(ItemTest, ClonePreservesType) {
   Cigarette c;
   auto cloned = c.clone();
@@ -475,7 +698,6 @@ TEST(ItemTest, HandcuffsNullSafe) {
   // Should not crash
 
   SimulatedPlayer p("Alice", 3);
-  Player::resetMaxHealth(3);
   cuffs.use(&p, nullptr, nullptr);
   // Should not crash
 }
@@ -485,7 +707,6 @@ TEST(ItemTest, HandcuffsNullSafe) {
 TEST(ItemTest, HandsawSetsSawUsed) {
   SimulatedShotgun sg(4, 2, 2, false);
   SimulatedPlayer p("Alice", 3);
-  Player::resetMaxHealth(3);
 
   EXPECT_FALSE(sg.getSawUsed());
   Handsaw saw;
@@ -498,14 +719,12 @@ TEST(ItemTest, HandsawNullSafe) {
   saw.use(nullptr, nullptr, nullptr);
 
   SimulatedPlayer p("Alice", 3);
-  Player::resetMaxHealth(3);
   saw.use(&p, nullptr, nullptr);
 }
 
 // --- MagnifyingGlass ---
 
 TEST(ItemTest, MagnifyingGlassRevealsShell) {
-  Player::resetMaxHealth(3);
   Shotgun sg;
   sg.loadShells();
   SimulatedPlayer p("Alice", 3);
@@ -520,17 +739,15 @@ TEST(ItemTest, MagnifyingGlassNullSafe) {
   glass.use(nullptr, nullptr, nullptr);
 
   SimulatedPlayer p("Alice", 3);
-  Player::resetMaxHealth(3);
   glass.use(&p, nullptr, nullptr);
 }
 
 // --- Beer ---
 
 TEST(ItemTest, BeerEjectsShell) {
-  Player::resetMaxHealth(3);
   SimulatedShotgun sg(4, 2, 2, false);
-  // Beer calls rackShell which needs loadedShells, but SimulatedShotgun
-  // doesn't load shells into the deque. Use a real Shotgun for this test.
+  // Beer racks the next shell; use a real, randomly loaded Shotgun so the
+  // ejected shell can be either type.
   Shotgun realSg;
   realSg.loadShells();
   int totalBefore = realSg.getTotalShellCount();
@@ -546,7 +763,6 @@ TEST(ItemTest, BeerNullSafe) {
   beer.use(nullptr, nullptr, nullptr);
 
   SimulatedPlayer p("Alice", 3);
-  Player::resetMaxHealth(3);
   beer.use(&p, nullptr, nullptr);
 }
 
@@ -611,6 +827,25 @@ TEST(SimulatedShotgunTest, DrainAllSimulated) {
   EXPECT_TRUE(ss.isEmpty());
 }
 
+TEST(SimulatedShotgunTest, ConstructorOverfullThrows) {
+  EXPECT_THROW(SimulatedShotgun(Shotgun::MAX_SHELLS + 1, Shotgun::MAX_SHELLS,
+                                1, false),
+               InvalidGameArgumentException);
+  EXPECT_THROW(SimulatedShotgun(2, -1, 3, false), InvalidGameArgumentException);
+}
+
+TEST(SimulatedShotgunTest, LiveShellsComeFirst) {
+  SimulatedShotgun ss(5, 2, 3, false);
+  EXPECT_EQ(ss.revealNextShell(), ShellType::LIVE_SHELL);
+  ss.simulateBlankShell();
+  ss.rackShell();
+  EXPECT_EQ(ss.getLiveShellCount(), 1);
+  EXPECT_EQ(ss.getBlankShellCount(), 2);
+  ss.simulateLiveShell();
+  EXPECT_EQ(ss.revealNextShell(), ShellType::BLANK_SHELL);
+  EXPECT_EQ(ss.getBlankShellCount(), 2);
+}
+
 TEST(SimulatedShotgunTest, ProbabilityAfterSimulation) {
   SimulatedShotgun ss(4, 2, 2, false);
   ss.simulateLiveShell();
@@ -807,6 +1042,461 @@ TEST_F(PlayerTestFixture, SimulatedGameChangePlayerTurn) {
   EXPECT_FALSE(game.isPlayerOneTurnNow());
 }
 
+// ============================================================
+// HeadlessGame Tests
+// ============================================================
+
+/**
+ * @brief Deterministic player that always shoots its opponent.
+ */
+class OpponentShooter final : public Player {
+public:
+  using Player::Player;
+
+  Action chooseAction(Shotgun * /*currentShotgun*/) override {
+    return Action::SHOOT_OPPONENT;
+  }
+};
+
+TEST_F(PlayerTestFixture, HeadlessGamePlaysToCompletionWithoutPauses) {
+  OpponentShooter p1("Alice", 3);
+  OpponentShooter p2("Bob", 3);
+  p1.setOpponent(&p2);
+  p2.setOpponent(&p1);
+
+  auto start = std::chrono::steady_clock::now();
+  HeadlessGame game(&p1, &p2, true, Random::gameSeed(1, 0));
+  game.runGame();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  // A Game would pause at least once per reload and round.
+  EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+  EXPECT_EQ(std::max(game.getPlayerOneWins(), game.getPlayerTwoWins()), 3);
+  EXPECT_LT(std::min(game.getPlayerOneWins(), game.getPlayerTwoWins()), 3);
+}
+
+TEST_F(PlayerTestFixture, HeadlessGamesWithSameSeedMatch) {
+  for (uint64_t index = 0; index < 5; index++) {
+    OpponentShooter a1("A1", 3), a2("A2", 3), b1("B1", 3), b2("B2", 3);
+    a1.setOpponent(&a2);
+    a2.setOpponent(&a1);
+    b1.setOpponent(&b2);
+    b2.setOpponent(&b1);
+
+    HeadlessGame first(&a1, &a2, true, Random::gameSeed(7, index));
+    HeadlessGame second(&b1, &b2, true, Random::gameSeed(7, index));
+    first.runGame();
+    second.runGame();
+    EXPECT_EQ(first.getPlayerOneWins(), second.getPlayerOneWins());
+    EXPECT_EQ(first.getPlayerTwoWins(), second.getPlayerTwoWins());
+  }
+}
+
+TEST(GameConfigTest, GameAppliesMaxHealthToBothPlayers) {
+  OpponentShooter p1("Alice", 3);
+  OpponentShooter p2("Bob", 2);
+  GameConfig config;
+  config.maxHealth = 6;
+
+  HeadlessGame game(&p1, &p2, true, 0, config);
+  EXPECT_EQ(game.getConfig().maxHealth, 6);
+  EXPECT_EQ(p1.getMaxHealth(), 6);
+  EXPECT_EQ(p2.getMaxHealth(), 6);
+  EXPECT_EQ(p2.getHealth(), 6);
+  EXPECT_EQ(SearchState::fromPlayers(p1, p2, *game.getShotgun()).maxHealth, 6);
+}
+
+TEST(GameConfigTest, MaxHealthIsPerPlayer) {
+  SimulatedPlayer small("Alice", 2);
+  SimulatedPlayer large("Bob", 5);
+  small.loseHealth(false);
+  large.loseHealth(false);
+  small.smokeCigarette();
+  small.smokeCigarette();
+  large.smokeCigarette();
+  EXPECT_EQ(small.getHealth(), 2);
+  EXPECT_EQ(large.getHealth(), 5);
+  EXPECT_THROW(small.setMaxHealth(0), InvalidGameArgumentException);
+}
+
+TEST(GameConfigTest, InvalidConfigsThrow) {
+  OpponentShooter p1("Alice", 3);
+  OpponentShooter p2("Bob", 3);
+  GameConfig config;
+  config.maxHealth = 0;
+  EXPECT_THROW(HeadlessGame(&p1, &p2, true, 0, config),
+               InvalidGameArgumentException);
+  config = GameConfig{};
+  config.roundsToWin = 0;
+  EXPECT_THROW(HeadlessGame(&p1, &p2, true, 0, config),
+               InvalidGameArgumentException);
+  config = GameConfig{};
+  config.minItemsPerRound = 4;
+  config.maxItemsPerRound = 3;
+  EXPECT_THROW(HeadlessGame(&p1, &p2, true, 0, config),
+               InvalidGameArgumentException);
+}
+
+TEST(GameConfigTest, ConcurrentGamesKeepTheirOwnRules) {
+  auto play = [](int maxHealth, int roundsToWin) {
+    OpponentShooter p1("Alice", 1);
+    OpponentShooter p2("Bob", 1);
+    p1.setOpponent(&p2);
+    p2.setOpponent(&p1);
+    GameConfig config;
+    config.maxHealth = maxHealth;
+    config.roundsToWin = roundsToWin;
+    HeadlessGame game(&p1, &p2, true, Random::gameSeed(11, 0), config);
+    game.runGame();
+    return std::max(game.getPlayerOneWins(), game.getPlayerTwoWins()) ==
+               roundsToWin &&
+           p1.getMaxHealth() == maxHealth && p2.getMaxHealth() == maxHealth;
+  };
+
+  std::vector<std::future<bool>> games;
+  for (int i = 1; i <= 4; i++)
+    games.push_back(std::async(std::launch::async, play, i, i));
+  for (auto &game : games)
+    EXPECT_TRUE(game.get());
+}
+
+/**
+ * @brief Sink that keeps every event it receives.
+ */
+class RecordingSink final : public GameEventSink {
+public:
+  std::vector<GameEvent> events;
+
+  void onEvent(const GameEvent &event, const Game & /*game*/) override {
+    events.push_back(event);
+  }
+
+  [[nodiscard]] int count(GameEventType type) const {
+    return static_cast<int>(
+        std::count_if(events.begin(), events.end(),
+                      [type](const GameEvent &e) { return e.type == type; }));
+  }
+};
+
+TEST_F(PlayerTestFixture, HeadlessGameReportsEventsToAttachedSink) {
+  OpponentShooter p1("Alice", 3);
+  OpponentShooter p2("Bob", 3);
+  p1.setOpponent(&p2);
+  p2.setOpponent(&p1);
+
+  RecordingSink sink;
+  HeadlessGame game(&p1, &p2, true, Random::gameSeed(3, 0));
+  game.setEventSink(sink);
+  game.runGame();
+
+  ASSERT_FALSE(sink.events.empty());
+  EXPECT_EQ(sink.events.back().type, GameEventType::GAME_WON);
+  EXPECT_EQ(sink.count(GameEventType::GAME_WON), 1);
+  EXPECT_EQ(sink.count(GameEventType::ROUND_WON),
+            game.getPlayerOneWins() + game.getPlayerTwoWins());
+  EXPECT_EQ(sink.count(GameEventType::PLAYER_ELIMINATED),
+            sink.count(GameEventType::ROUND_WON));
+  EXPECT_EQ(sink.count(GameEventType::SHELLS_LOADED),
+            sink.count(GameEventType::MAGAZINE_EMPTY) +
+                sink.count(GameEventType::ROUND_WON));
+
+  // Nobody uses items, so every shell loaded is fired.
+  int shellsLoaded = 0;
+  for (const GameEvent &event : sink.events)
+    if (event.type == GameEventType::SHELLS_LOADED)
+      shellsLoaded += event.live + event.blank;
+  EXPECT_GE(shellsLoaded, sink.count(GameEventType::SHOT_FIRED));
+}
+
+TEST_F(PlayerTestFixture, NarratedHeadlessGameShowsLoadsAndResult) {
+  for (const bool narrated : {false, true}) {
+    OpponentShooter p1("Alice", 3);
+    OpponentShooter p2("Bob", 3);
+    p1.setOpponent(&p2);
+    p2.setOpponent(&p1);
+
+    std::ostringstream out;
+    std::streambuf *original = std::cout.rdbuf(out.rdbuf());
+    HeadlessGame game(&p1, &p2, true, Random::gameSeed(3, 0));
+    game.setNarrated(narrated);
+    game.runGame();
+    std::cout.rdbuf(original);
+
+    const std::string winner =
+        game.getPlayerOneWins() > game.getPlayerTwoWins() ? "Alice" : "Bob";
+    if (narrated) {
+      EXPECT_NE(out.str().find("Shotgun was loaded with"), std::string::npos);
+      EXPECT_NE(out.str().find("Round 2"), std::string::npos);
+      EXPECT_NE(out.str().find(winner + " wins the game"), std::string::npos);
+    } else {
+      EXPECT_TRUE(out.str().empty());
+    }
+  }
+}
+
+TEST(GameEventSinkTest, BinaryRecordsRoundTrip) {
+  const GameEvent events[] = {
+      GameEvent::itemReceived(1, ItemKind::HANDSAW),
+      GameEvent::shellsLoaded(3, 5, 0x2C),
+      GameEvent::actionChosen(0, Action::USE_HANDSAW, 9, -123.5f),
+      GameEvent::shotFired(0, 1, ShellType::LIVE_SHELL),
+      GameEvent::itemUsed(1, ItemKind::MAGNIFYING_GLASS,
+                          ShellType::LIVE_SHELL, true),
+      GameEvent::gameWon(1)};
+
+  std::ostringstream out;
+  BinaryEventSink sink(out);
+  OpponentShooter p1("Alice", 3);
+  OpponentShooter p2("Bob", 3);
+  HeadlessGame game(&p1, &p2, true, 0);
+  for (const GameEvent &event : events)
+    sink.onEvent(event, game);
+
+  const std::string bytes = out.str();
+  ASSERT_EQ(bytes.size(), std::size(events) * BinaryEventSink::RECORD_SIZE);
+  for (size_t i = 0; i < std::size(events); i++) {
+    const GameEvent decoded = BinaryEventSink::decode(
+        reinterpret_cast<const uint8_t *>(bytes.data()) +
+        i * BinaryEventSink::RECORD_SIZE);
+    EXPECT_EQ(decoded.type, events[i].type);
+    EXPECT_EQ(decoded.seat, events[i].seat);
+    EXPECT_EQ(decoded.target, events[i].target);
+    EXPECT_EQ(decoded.item, events[i].item);
+    EXPECT_EQ(decoded.shell, events[i].shell);
+    EXPECT_EQ(decoded.live, events[i].live);
+    EXPECT_EQ(decoded.blank, events[i].blank);
+    EXPECT_EQ(decoded.hidden, events[i].hidden);
+    EXPECT_EQ(decoded.action, events[i].action);
+    EXPECT_EQ(decoded.depth, events[i].depth);
+    EXPECT_EQ(decoded.shells, events[i].shells);
+    EXPECT_EQ(decoded.value, events[i].value);
+  }
+}
+
+TEST(GameEventSinkTest, DecodeRejectsMalformedRecords) {
+  uint8_t record[BinaryEventSink::RECORD_SIZE];
+  BinaryEventSink::encode(GameEvent::roundWon(0), record);
+  record[0] = 0xFF;
+  EXPECT_THROW((void)BinaryEventSink::decode(record),
+               InvalidGameArgumentException);
+}
+
+TEST(GameRecordTest, WrittenGamesReadBack) {
+  const std::string path = ::testing::TempDir() + "game_record_test.bin";
+  GameConfig config;
+  config.maxHealth = 2;
+  config.roundsToWin = 2;
+
+  // Two games framed on separate threads and queued to one writer.
+  std::vector<GameRecord> played(2);
+  {
+    GameRecordWriter writer(path);
+    std::vector<std::thread> games;
+    for (uint64_t index = 0; index < played.size(); index++) {
+      games.emplace_back([&, index] {
+        OpponentShooter p1("Alice", 1);
+        OpponentShooter p2("Bob", 1);
+        p1.setOpponent(&p2);
+        p2.setOpponent(&p1);
+        RecordingSink events;
+        GameRecorder recorder(&events);
+        HeadlessGame game(&p1, &p2, index == 0, Random::gameSeed(5, index),
+                          config);
+        game.setEventSink(recorder);
+        game.runGame();
+        writer.submit(recorder.frame(game, index, index == 0));
+
+        GameRecord &expected = played[index];
+        expected.seed = game.getSeed();
+        expected.playerOneWins = game.getPlayerOneWins();
+        expected.playerTwoWins = game.getPlayerTwoWins();
+        expected.events = events.events;
+      });
+    }
+    for (auto &game : games)
+      game.join();
+    writer.close();
+  }
+
+  GameRecordReader reader(path);
+  GameRecord record;
+  int games = 0;
+  while (reader.next(record)) {
+    ASSERT_LT(record.index, played.size());
+    const GameRecord &expected = played[record.index];
+    EXPECT_EQ(record.seed, expected.seed);
+    EXPECT_EQ(record.config.maxHealth, 2);
+    EXPECT_EQ(record.config.roundsToWin, 2);
+    EXPECT_EQ(record.playerOneStarts, record.index == 0);
+    EXPECT_EQ(record.playerOneWins, expected.playerOneWins);
+    EXPECT_EQ(record.playerTwoWins, expected.playerTwoWins);
+    ASSERT_EQ(record.events.size(), expected.events.size());
+    int choices = 0;
+    int shots = 0;
+    for (size_t i = 0; i < record.events.size(); i++) {
+      const GameEvent &event = record.events[i];
+      EXPECT_EQ(event.type, expected.events[i].type);
+      EXPECT_EQ(event.seat, expected.events[i].seat);
+      EXPECT_EQ(event.shell, expected.events[i].shell);
+      if (event.type == GameEventType::SHELLS_LOADED) {
+        int live = 0;
+        for (int bit = 0; bit < event.live + event.blank; bit++)
+          live += (event.shells >> bit) & 1;
+        EXPECT_EQ(live, event.live);
+      }
+      choices += event.type == GameEventType::ACTION_CHOSEN;
+      shots += event.type == GameEventType::SHOT_FIRED;
+    }
+    EXPECT_EQ(choices, shots);
+    games++;
+  }
+  EXPECT_EQ(games, 2);
+  std::remove(path.c_str());
+}
+
+TEST(GameRecordTest, ReaderRejectsForeignAndTruncatedFiles) {
+  const std::string path = ::testing::TempDir() + "not_a_game_record.bin";
+  std::remove(path.c_str());
+  EXPECT_THROW(GameRecordReader{path}, GameRecordException);
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << "definitely not a game record";
+  }
+  EXPECT_THROW(GameRecordReader{path}, GameRecordException);
+
+  OpponentShooter p1("Alice", 3);
+  OpponentShooter p2("Bob", 3);
+  p1.setOpponent(&p2);
+  p2.setOpponent(&p1);
+  GameRecorder recorder;
+  HeadlessGame game(&p1, &p2, true, 1);
+  game.setEventSink(recorder);
+  game.runGame();
+  std::vector<uint8_t> frame = recorder.frame(game, 0, true);
+  {
+    GameRecordWriter writer(path);
+    frame.resize(frame.size() - 1);
+    writer.submit(frame);
+  }
+  GameRecordReader reader(path);
+  GameRecord record;
+  EXPECT_THROW((void)reader.next(record), GameRecordException);
+  std::remove(path.c_str());
+}
+
+/**
+ * @brief Plays a short recorded game.
+ * @param bots True for two BotPlayers, false for two OpponentShooters.
+ * @param seed Seed of the game.
+ * @return The game's record.
+ */
+static GameRecord recordShortGame(bool bots, uint64_t seed) {
+  GameConfig config;
+  config.maxHealth = 1;
+  config.roundsToWin = 1;
+
+  std::unique_ptr<Player> p1, p2;
+  if (bots) {
+    p1 = std::make_unique<BotPlayer>("Bot1", 1);
+    p2 = std::make_unique<BotPlayer>("Bot2", 1);
+  } else {
+    p1 = std::make_unique<OpponentShooter>("Alice", 1);
+    p2 = std::make_unique<OpponentShooter>("Bob", 1);
+  }
+  p1->setOpponent(p2.get());
+  p2->setOpponent(p1.get());
+
+  RecordingSink events;
+  HeadlessGame game(p1.get(), p2.get(), true, seed, config);
+  game.setEventSink(events);
+  game.runGame();
+
+  GameRecord record;
+  record.seed = seed;
+  record.config = config;
+  record.playerOneWins = game.getPlayerOneWins();
+  record.playerTwoWins = game.getPlayerTwoWins();
+  record.events = events.events;
+  return record;
+}
+
+TEST(ReplayTest, ReplayedGamesFollowTheirRecord) {
+  const GameRecord record = recordShortGame(true, 21);
+  const int choices = static_cast<int>(
+      std::count_if(record.events.begin(), record.events.end(),
+                    [](const GameEvent &e) {
+                      return e.type == GameEventType::ACTION_CHOSEN;
+                    }));
+
+  const ReplayResult result = Replay::replayGame(record, {});
+  EXPECT_FALSE(result.desynced) << result.desyncReason;
+  EXPECT_EQ(result.decisions, choices);
+}
+
+TEST(ReplayTest, DivergingDecisionsAreReported) {
+  // Players who always shoot the other make choices a bot will not always
+  // share; the recorded actions are still played, so the game stays in sync.
+  const GameRecord record = recordShortGame(false, 4);
+  int setups = 0;
+  const ReplayResult result =
+      Replay::replayGame(record, [&](BotPlayer &) { setups++; });
+  EXPECT_EQ(setups, 2);
+  EXPECT_FALSE(result.desynced) << result.desyncReason;
+  EXPECT_FALSE(result.divergences.empty());
+  for (const ReplayDivergence &divergence : result.divergences) {
+    EXPECT_EQ(divergence.recorded, Action::SHOOT_OPPONENT);
+    EXPECT_NE(divergence.replayed, Action::SHOOT_OPPONENT);
+    EXPECT_LT(divergence.decision, result.decisions);
+  }
+}
+
+TEST(ReplayTest, AlteredRecordsDesync) {
+  GameRecord record = recordShortGame(false, 4);
+  auto loaded = std::find_if(record.events.begin(), record.events.end(),
+                             [](const GameEvent &e) {
+                               return e.type == GameEventType::SHELLS_LOADED;
+                             });
+  ASSERT_NE(loaded, record.events.end());
+  loaded->shells ^= 1u;
+  const ReplayResult result = Replay::replayGame(record, {});
+  EXPECT_TRUE(result.desynced);
+  EXPECT_EQ(result.decisions, 0);
+
+  record = recordShortGame(false, 4);
+  record.seed++;
+  EXPECT_TRUE(Replay::replayGame(record, {}).desynced);
+}
+
+TEST_F(PlayerTestFixture, ConsoleSinkNarratesItemUse) {
+  OpponentShooter p1("Alice", 3);
+  OpponentShooter p2("Bob", 3);
+  p1.setOpponent(&p2);
+  p2.setOpponent(&p1);
+  p1.addItem(ItemKind::CIGARETTE);
+
+  Game game(&p1, &p2, true, 0);
+  testing::internal::CaptureStdout();
+  EXPECT_FALSE(game.performAction(Action::SMOKE_CIGARETTE));
+  EXPECT_FALSE(game.performAction(Action::SMOKE_CIGARETTE));
+  EXPECT_EQ(testing::internal::GetCapturedStdout(),
+            "Alice uses Cigarette and restores 1 HP.\n"
+            "Alice has no Cigarette to smoke.\n");
+}
+
+TEST_F(PlayerTestFixture, NullSinkKeepsRulesSilent) {
+  OpponentShooter p1("Alice", 3);
+  OpponentShooter p2("Bob", 3);
+  p1.setOpponent(&p2);
+  p2.setOpponent(&p1);
+  p1.addItem(ItemKind::HANDCUFFS);
+
+  HeadlessGame game(&p1, &p2, true, 0);
+  testing::internal::CaptureStdout();
+  EXPECT_FALSE(game.performAction(Action::USE_HANDCUFFS));
+  EXPECT_TRUE(p2.areHandcuffsApplied());
+  EXPECT_EQ(testing::internal::GetCapturedStdout(), "");
+}
+
 // ============================================================
 // Game Action Tests (using SimulatedGame + real Shotgun logic)
 // ============================================================
@@ -882,3 +1572,1135 @@ TEST_F(PlayerTestFixture, PlayerCopyDeepCopiesItems) {
   EXPECT_EQ(copy.getItemCount(), 2);
   EXPECT_EQ(original.getItemCount(), 3);
 }
+
+// ============================================================
+// SearchState Tests
+// ============================================================
+
+TEST_F(PlayerTestFixture, SearchStateFromGameCopiesPosition) {
+  auto *p1 = new SimulatedPlayer("Alice", 3);
+  auto *p2 = new SimulatedPlayer("Bob", 2);
+  p1->addItem(std::make_unique<Beer>());
+  p1->addItem(std::make_unique<Beer>());
+  p1->addItem(std::make_unique<Handsaw>());
+  p1->setKnownNextShell(ShellType::LIVE_SHELL);
+  p2->applyHandcuffs();
+  SimulatedGame game(p1, p2, new SimulatedShotgun(5, 3, 2, true), false);
+
+  SearchState state = SearchState::fromGame(game);
+  EXPECT_EQ(state.players[SearchState::PLAYER_ONE].health, 3);
+  EXPECT_EQ(state.players[SearchState::PLAYER_TWO].health, 2);
+  EXPECT_EQ(state.players[SearchState::PLAYER_ONE]
+                .items[static_cast<int>(ItemKind::BEER)],
+            2);
+  EXPECT_TRUE(state.hasItem(SearchState::PLAYER_ONE, ItemKind::HANDSAW));
+  EXPECT_FALSE(state.hasItem(SearchState::PLAYER_TWO, ItemKind::HANDSAW));
+  EXPECT_TRUE(state.players[SearchState::PLAYER_ONE].shellRevealed);
+  EXPECT_TRUE(state.players[SearchState::PLAYER_TWO].handcuffed);
+  EXPECT_EQ(state.liveShells, 3);
+  EXPECT_EQ(state.blankShells, 2);
+  EXPECT_TRUE(state.sawActive);
+  EXPECT_FALSE(state.playerOneTurn);
+  EXPECT_EQ(state.maxHealth, 3);
+  EXPECT_EQ(state.hash, state.computeHash());
+  EXPECT_FLOAT_EQ(state.liveProbability(), 0.6f);
+}
+
+TEST_F(PlayerTestFixture, SearchStateFromPlayersPutsSelfFirst) {
+  SimulatedPlayer self("Alice", 2);
+  SimulatedPlayer opponent("Bob", 3);
+  self.addItem(std::make_unique<Cigarette>());
+  Shotgun shotgun;
+
+  SearchState state = SearchState::fromPlayers(self, opponent, shotgun);
+  EXPECT_TRUE(state.playerOneTurn);
+  EXPECT_EQ(state.players[SearchState::PLAYER_ONE].health, 2);
+  EXPECT_TRUE(state.hasItem(SearchState::PLAYER_ONE, ItemKind::CIGARETTE));
+  EXPECT_EQ(state.totalShells(), 0);
+}
+
+TEST_F(PlayerTestFixture, SearchStateMutatorsKeepHashInSync) {
+  auto *p1 = new SimulatedPlayer("Alice", 3);
+  auto *p2 = new SimulatedPlayer("Bob", 3);
+  p1->addItem(std::make_unique<Handcuffs>());
+  SimulatedGame game(p1, p2, new SimulatedShotgun(4, 2, 2, false), true);
+  SearchState state = SearchState::fromGame(game);
+  const uint64_t original = state.hash;
+
+  state.setHealth(SearchState::PLAYER_TWO, 2);
+  state.removeItem(SearchState::PLAYER_ONE, ItemKind::HANDCUFFS);
+  state.setHandcuffed(SearchState::PLAYER_TWO, true);
+  state.setUsedHandcuffsThisTurn(SearchState::PLAYER_ONE, true);
+  state.revealShell(SearchState::PLAYER_ONE, ShellType::BLANK_SHELL);
+  state.revealShell(SearchState::PLAYER_ONE, ShellType::LIVE_SHELL);
+  state.setSawActive(true);
+  state.removeShell(ShellType::LIVE_SHELL);
+  state.setPlayerOneTurn(false);
+  EXPECT_EQ(state.hash, state.computeHash());
+  EXPECT_NE(state.hash, original);
+
+  state.forgetShell(SearchState::PLAYER_ONE);
+  EXPECT_FALSE(state.players[SearchState::PLAYER_ONE].shellRevealed);
+  EXPECT_EQ(state.hash, state.computeHash());
+}
+
+TEST_F(PlayerTestFixture, SearchStateRemoveMissingThrows) {
+  auto *p1 = new SimulatedPlayer("Alice", 3);
+  auto *p2 = new SimulatedPlayer("Bob", 3);
+  SimulatedGame game(p1, p2, new SimulatedShotgun(2, 2, 0, false), true);
+  SearchState state = SearchState::fromGame(game);
+
+  EXPECT_THROW(state.removeItem(SearchState::PLAYER_ONE, ItemKind::BEER),
+               SimulationException);
+  EXPECT_THROW(state.removeShell(ShellType::BLANK_SHELL), SimulationException);
+}
+
+TEST_F(PlayerTestFixture, SearchStateApplyFollowsShotRules) {
+  auto *p1 = new SimulatedPlayer("Alice", 3);
+  auto *p2 = new SimulatedPlayer("Bob", 3);
+  p2->applyHandcuffs();
+  SimulatedGame game(p1, p2, new SimulatedShotgun(4, 2, 2, true), true);
+  SearchState state = SearchState::fromGame(game);
+  SearchState::UndoRecord undo{};
+
+  // Sawed live shot at a cuffed opponent: 2 damage, cuffs spent, turn kept.
+  state.apply(Action::SHOOT_OPPONENT, ShellType::LIVE_SHELL, undo);
+  EXPECT_EQ(state.players[SearchState::PLAYER_TWO].health, 1);
+  EXPECT_FALSE(state.players[SearchState::PLAYER_TWO].handcuffed);
+  EXPECT_FALSE(state.sawActive);
+  EXPECT_EQ(state.liveShells, 1);
+  EXPECT_TRUE(state.playerOneTurn);
+
+  // Blank at yourself keeps the turn; a live one passes it.
+  state.apply(Action::SHOOT_SELF, ShellType::BLANK_SHELL, undo);
+  EXPECT_TRUE(state.playerOneTurn);
+  state.apply(Action::SHOOT_SELF, ShellType::LIVE_SHELL, undo);
+  EXPECT_EQ(state.players[SearchState::PLAYER_ONE].health, 2);
+  EXPECT_FALSE(state.playerOneTurn);
+  EXPECT_EQ(state.hash, state.computeHash());
+}
+
+TEST_F(PlayerTestFixture, SearchStateUndoRestoresEveryAction) {
+  auto *p1 = new SimulatedPlayer("Alice", 2);
+  auto *p2 = new SimulatedPlayer("Bob", 3);
+  p1->addItem(std::make_unique<Beer>());
+  p1->addItem(std::make_unique<Cigarette>());
+  p1->addItem(std::make_unique<Handcuffs>());
+  p1->addItem(std::make_unique<Handsaw>());
+  p1->addItem(std::make_unique<MagnifyingGlass>());
+  SimulatedGame game(p1, p2, new SimulatedShotgun(4, 2, 2, false), true);
+  const SearchState original = SearchState::fromGame(game);
+
+  for (Action action : BotPlayer::determineFeasibleActions(original)) {
+    for (ShellType shell : {ShellType::LIVE_SHELL, ShellType::BLANK_SHELL}) {
+      SearchState state = original;
+      SearchState::UndoRecord undo{};
+      state.apply(action, shell, undo);
+      EXPECT_EQ(state.hash, state.computeHash());
+      state.undo(undo);
+      EXPECT_EQ(std::memcmp(&state, &original, sizeof(SearchState)), 0)
+          << "action " << static_cast<int>(action);
+    }
+  }
+}
+
+TEST_F(PlayerTestFixture, SearchStateApplyThrowsWithoutChanges) {
+  auto *p1 = new SimulatedPlayer("Alice", 3);
+  auto *p2 = new SimulatedPlayer("Bob", 3);
+  SimulatedGame game(p1, p2, new SimulatedShotgun(2, 2, 0, false), true);
+  SearchState state = SearchState::fromGame(game);
+  const uint64_t original = state.hash;
+  SearchState::UndoRecord undo{};
+
+  EXPECT_THROW(state.apply(Action::DRINK_BEER, ShellType::LIVE_SHELL, undo),
+               SimulationException);
+  EXPECT_THROW(state.apply(Action::SHOOT_SELF, ShellType::BLANK_SHELL, undo),
+               SimulationException);
+  EXPECT_EQ(state.hash, original);
+  EXPECT_EQ(state.liveShells, 2);
+}
+
+TEST_F(PlayerTestFixture, SearchStateTextRoundTrips) {
+  auto *p1 = new SimulatedPlayer("Alice", 3);
+  auto *p2 = new SimulatedPlayer("Bob", 3);
+  p1->addItem(std::make_unique<Handsaw>());
+  p1->addItem(std::make_unique<Beer>());
+  p1->addItem(std::make_unique<Beer>());
+  p2->addItem(std::make_unique<MagnifyingGlass>());
+  p2->loseHealth(false);
+  p2->applyHandcuffs();
+  p1->setKnownNextShell(ShellType::LIVE_SHELL);
+  SimulatedGame game(p1, p2, new SimulatedShotgun(5, 3, 2, true), true);
+  const SearchState state = SearchState::fromGame(game);
+
+  EXPECT_EQ(state.toString(), "3 3/BBS/l 2/M/x 3/2 1 s");
+  EXPECT_EQ(SearchState::fromString(state.toString()), state);
+  EXPECT_EQ(SearchState::fromString("  3 3/BBS/l   2/M/x 3/2 1 s\n"), state);
+
+  const SearchState mirrored = state.mirrored();
+  EXPECT_EQ(mirrored.toString(), "3 2/M/x 3/BBS/l 3/2 2 s");
+  EXPECT_EQ(SearchState::fromString(mirrored.toString()), mirrored);
+}
+
+TEST(SearchStateTextTest, MalformedPositionsThrow) {
+  for (const char *text : {
+           "",
+           "3 3/-/- 3/-/- 2/2 1",           // missing field
+           "3 3/-/- 3/-/- 2/2 1 - extra",   // extra field
+           "0 3/-/- 3/-/- 2/2 1 -",         // max health too low
+           "3 4/-/- 3/-/- 2/2 1 -",         // health above the cap
+           "3 3/-/- 3/-/- 5/4 1 -",         // too many shells
+           "3 3/BZ/- 3/-/- 2/2 1 -",        // unknown item
+           "3 3/BBBBBBBBB/- 3/-/- 2/2 1 -", // too many items
+           "3 3/-/q 3/-/- 2/2 1 -",         // unknown flag
+           "3 3/-/lb 3/-/- 2/2 1 -",        // shell known twice
+           "3 3/-/l 3/-/- 0/2 1 -",         // known shell not loaded
+           "3 3/- 3/-/- 2/2 1 -",           // side without flags
+           "3 3/-/- 3/-/- 2/2 3 -",         // bad side to move
+           "3 3/-/- 3/-/- 2/2 1 x"}) {      // bad saw field
+    EXPECT_THROW((void)SearchState::fromString(text),
+                 InvalidGameArgumentException)
+        << text;
+  }
+}
+
+TEST(PerftTest, CountsSmallTreeByHand) {
+  // One live and one blank, no items: two shots, each a chance node.  After
+  // a blank only the live shell is left, and the generator then offers a
+  // single shot.
+  const SearchState state = SearchState::fromString("1 1/-/- 1/-/- 1/1 1 -");
+  const PerftCounts one = Perft::count(state, 1, true);
+  EXPECT_EQ(one.decisionNodes, 1u);
+  EXPECT_EQ(one.chanceNodes, 2u);
+  EXPECT_EQ(one.leafNodes, 4u);
+
+  const PerftCounts two = Perft::count(state, 2, true);
+  EXPECT_EQ(two.decisionNodes, 3u);
+  EXPECT_EQ(two.chanceNodes, 2u);
+  EXPECT_EQ(two.leafNodes, 4u);
+  EXPECT_EQ(two.total(), 9u);
+
+  EXPECT_EQ(Perft::count(state, 0, false).total(), 1u);
+  EXPECT_THROW((void)Perft::count(state, -1, false),
+               InvalidGameArgumentException);
+}
+
+TEST(PerftTest, DivideSumsToCountAndVerifyPasses) {
+  const SearchState state =
+      SearchState::fromString("3 3/BCHSM/- 2/BHM/- 4/3 1 -");
+  const PerftCounts counts = Perft::count(state, 4, true);
+  PerftCounts summed;
+  summed.decisionNodes = 1; // The root.
+  for (const PerftDivision &division : Perft::divide(state, 4, true))
+    summed += division.counts;
+  EXPECT_EQ(summed.decisionNodes, counts.decisionNodes);
+  EXPECT_EQ(summed.chanceNodes, counts.chanceNodes);
+  EXPECT_EQ(summed.leafNodes, counts.leafNodes);
+  EXPECT_TRUE(Perft::divide(SearchState::fromString("3 0/-/- 2/-/- 2/2 1 -"),
+                            2, false)
+                  .empty());
+}
+
+// ============================================================
+// Zobrist Hashing Tests
+// ============================================================
+
+TEST_F(PlayerTestFixture, ZobristHashIgnoresItemOrder) {
+  auto *p1 = new SimulatedPlayer("Alice", 3);
+  auto *p2 = new SimulatedPlayer("Bob", 3);
+  p1->addItem(std::make_unique<Beer>());
+  p1->addItem(std::make_unique<Handsaw>());
+  SimulatedGame first(p1, p2, new SimulatedShotgun(4, 2, 2, false), true);
+
+  auto *p3 = new SimulatedPlayer("Alice", 3);
+  auto *p4 = new SimulatedPlayer("Bob", 3);
+  p3->addItem(std::make_unique<Handsaw>());
+  p3->addItem(std::make_unique<Beer>());
+  SimulatedGame second(p3, p4, new SimulatedShotgun(4, 2, 2, false), true);
+
+  EXPECT_EQ(SearchState::fromGame(first).hash,
+            SearchState::fromGame(second).hash);
+}
+
+TEST_F(PlayerTestFixture, ZobristHashDistinguishesFeatures) {
+  auto *p1 = new SimulatedPlayer("Alice", 3);
+  auto *p2 = new SimulatedPlayer("Bob", 3);
+  SimulatedGame game(p1, p2, new SimulatedShotgun(4, 2, 2, false), true);
+  uint64_t base = SearchState::fromGame(game).hash;
+
+  game.changePlayerTurn(false);
+  EXPECT_NE(SearchState::fromGame(game).hash, base);
+  EXPECT_EQ(SearchState::fromGame(game).hash ^ Zobrist::playerOneTurnKey(),
+            base);
+  game.changePlayerTurn(true);
+
+  p2->applyHandcuffs();
+  EXPECT_NE(SearchState::fromGame(game).hash, base);
+  p2->removeHandcuffs();
+
+  p1->loseHealth(false);
+  EXPECT_NE(SearchState::fromGame(game).hash, base);
+  p1->smokeCigarette();
+  EXPECT_EQ(SearchState::fromGame(game).hash, base);
+
+  p1->addItem(std::make_unique<Cigarette>());
+  EXPECT_NE(SearchState::fromGame(game).hash, base);
+}
+
+// ============================================================
+// Transposition Table Tests
+// ============================================================
+
+TEST(TranspositionTableTest, SizeRoundsDownToPowerOfTwo) {
+  TranspositionTable table(1000);
+  EXPECT_EQ(table.size(), 512u);
+  EXPECT_THROW(TranspositionTable(0), InvalidGameArgumentException);
+}
+
+TEST(TranspositionTableTest, StoreAndProbe) {
+  TranspositionTable table(64);
+  TranspositionEntry entry;
+  EXPECT_FALSE(table.probe(42, entry));
+
+  table.store(42, 1.5f, 3, BoundType::LOWER, TranspositionEntry::NO_MOVE);
+  ASSERT_TRUE(table.probe(42, entry));
+  EXPECT_FLOAT_EQ(entry.value, 1.5f);
+  EXPECT_EQ(entry.depth, 3);
+  EXPECT_EQ(entry.bound, BoundType::LOWER);
+
+  // Same slot, different key: not a hit.
+  EXPECT_FALSE(table.probe(42 + 64, entry));
+}
+
+TEST(TranspositionTableTest, KeepsDeeperEntryWithinSearch) {
+  TranspositionTable table(64);
+  TranspositionEntry entry;
+
+  table.store(7, 10.0f, 5, BoundType::EXACT, TranspositionEntry::NO_MOVE);
+  table.store(7 + 64, 20.0f, 2, BoundType::EXACT, TranspositionEntry::NO_MOVE);
+  ASSERT_TRUE(table.probe(7, entry));
+  EXPECT_FLOAT_EQ(entry.value, 10.0f);
+
+  table.store(7 + 64, 30.0f, 6, BoundType::EXACT, TranspositionEntry::NO_MOVE);
+  ASSERT_TRUE(table.probe(7 + 64, entry));
+  EXPECT_FLOAT_EQ(entry.value, 30.0f);
+}
+
+TEST(TranspositionTableTest, NewSearchAgesOutEntries) {
+  TranspositionTable table(64);
+  TranspositionEntry entry;
+
+  table.store(7, 10.0f, 5, BoundType::EXACT, TranspositionEntry::NO_MOVE);
+  table.newSearch();
+  table.store(7 + 64, 20.0f, 1, BoundType::EXACT, TranspositionEntry::NO_MOVE);
+  ASSERT_TRUE(table.probe(7 + 64, entry));
+  EXPECT_FLOAT_EQ(entry.value, 20.0f);
+
+  table.clear();
+  EXPECT_FALSE(table.probe(7 + 64, entry));
+}
+
+TEST(TranspositionTableTest, ConcurrentStoresNeverMixEntries) {
+  TranspositionTable table(64);
+  table.newSearch();
+
+  // Every writer stores value == key into the same few slots; a torn slot
+  // would surface as a hit whose value does not match its key.
+  auto writer = [&table](uint64_t base) {
+    for (int i = 0; i < 20000; ++i) {
+      const uint64_t key = base + static_cast<uint64_t>(i % 256) * 64;
+      table.store(key, static_cast<float>(key), i % 8, BoundType::EXACT,
+                  TranspositionEntry::NO_MOVE);
+    }
+  };
+  std::thread first(writer, 1);
+  std::thread second(writer, 2);
+
+  TranspositionEntry entry;
+  for (int i = 0; i < 20000; ++i) {
+    const uint64_t key = 1 + static_cast<uint64_t>(i % 256) * 64;
+    if (table.probe(key, entry)) {
+      EXPECT_EQ(entry.value, static_cast<float>(key));
+    }
+  }
+  first.join();
+  second.join();
+}
+
+TEST(TranspositionTableTest, StoresBestMove) {
+  TranspositionTable table(64);
+  TranspositionEntry entry;
+
+  table.store(42, -2.5f, 4, BoundType::UPPER,
+              static_cast<int>(Action::USE_HANDSAW));
+  ASSERT_TRUE(table.probe(42, entry));
+  EXPECT_EQ(entry.bestMove, static_cast<int>(Action::USE_HANDSAW));
+  EXPECT_EQ(entry.bound, BoundType::UPPER);
+  EXPECT_FLOAT_EQ(entry.value, -2.5f);
+
+  table.store(42, 1.0f, 5, BoundType::EXACT, TranspositionEntry::NO_MOVE);
+  ASSERT_TRUE(table.probe(42, entry));
+  EXPECT_EQ(entry.bestMove, TranspositionEntry::NO_MOVE);
+}
+
+// ============================================================
+// Move Ordering Tests
+// ============================================================
+
+namespace {
+// Both sides hold every item, so every action is feasible.
+const char *const ORDERING_POSITION = "3 2/BCHSM/- 3/BCHSM/- 4/3 1 -";
+
+std::vector<Action> orderedActions(const MoveOrdering &ordering,
+                                   const SearchState &state, int depth,
+                                   int ttAction) {
+  ActionList actions = BotPlayer::determineFeasibleActions(state);
+  ordering.order(state, depth, ttAction, actions);
+  return {actions.begin(), actions.end()};
+}
+} // namespace
+
+TEST(MoveOrderingTest, WithoutHistoryFollowsStrategicPriority) {
+  const SearchState state = SearchState::fromString(ORDERING_POSITION);
+  MoveOrdering ordering;
+  const ActionList prioritized = BotPlayer::prioritizeStrategicActions(
+      BotPlayer::determineFeasibleActions(state), state);
+  EXPECT_EQ(prioritized.size(), ACTION_COUNT);
+  EXPECT_EQ(orderedActions(ordering, state, 3, MoveOrdering::NO_ACTION),
+            std::vector<Action>(prioritized.begin(), prioritized.end()));
+  EXPECT_EQ(prioritized[0], Action::USE_MAGNIFYING_GLASS);
+}
+
+TEST(MoveOrderingTest, TableActionThenKillersThenHistory) {
+  const SearchState state = SearchState::fromString(ORDERING_POSITION);
+  MoveOrdering ordering;
+  ordering.recordCutoff(state, 2, Action::SMOKE_CIGARETTE);
+  ordering.recordCutoff(state, 4, Action::DRINK_BEER);
+  ordering.recordCutoff(state, 4, Action::SHOOT_SELF);
+
+  std::vector<Action> order = orderedActions(
+      ordering, state, 4, static_cast<int>(Action::USE_HANDCUFFS));
+  ASSERT_EQ(order.size(), 7u);
+  EXPECT_EQ(order[0], Action::USE_HANDCUFFS);
+  EXPECT_EQ(order[1], Action::SHOOT_SELF);
+  EXPECT_EQ(order[2], Action::DRINK_BEER);
+  // Cut off at depth 2, weighted 4, so behind the depth-4 actions' 16.
+  EXPECT_EQ(order[3], Action::SMOKE_CIGARETTE);
+
+  // No killers at depth 3: history alone, deeper cutoffs first and equal
+  // scores by strategic priority.
+  order = orderedActions(ordering, state, 3, MoveOrdering::NO_ACTION);
+  EXPECT_EQ(order[0], Action::DRINK_BEER);
+  EXPECT_EQ(order[1], Action::SHOOT_SELF);
+  EXPECT_EQ(order[2], Action::SMOKE_CIGARETTE);
+  EXPECT_EQ(order[3], Action::USE_MAGNIFYING_GLASS);
+
+  // History is kept per side to move.
+  SearchState opponentToMove = state;
+  opponentToMove.playerOneTurn = false;
+  EXPECT_EQ(orderedActions(ordering, opponentToMove, 3,
+                           MoveOrdering::NO_ACTION)[0],
+            Action::USE_MAGNIFYING_GLASS);
+
+  ordering.clear();
+  EXPECT_EQ(orderedActions(ordering, state, 4, MoveOrdering::NO_ACTION)[0],
+            Action::USE_MAGNIFYING_GLASS);
+}
+
+TEST(MoveOrderingTest, PrincipalVariationComesFirst) {
+  const SearchState state = SearchState::fromString(ORDERING_POSITION);
+  PrincipalVariation line;
+  line.keys[0] = 1;
+  line.actions[0] = Action::SHOOT_OPPONENT;
+  line.keys[1] = state.hash;
+  line.actions[1] = Action::SMOKE_CIGARETTE;
+  line.length = 2;
+
+  // Depth 6 puts the position on the line's second ply: its action beats
+  // the table's.
+  MoveOrdering ordering;
+  ordering.followPrincipalVariation(line, 6);
+  const int ttAction = static_cast<int>(Action::DRINK_BEER);
+  std::vector<Action> order = orderedActions(ordering, state, 5, ttAction);
+  EXPECT_EQ(order[0], Action::SMOKE_CIGARETTE);
+  EXPECT_EQ(order[1], Action::DRINK_BEER);
+
+  // Anywhere else on the tree the line does not apply.
+  order = orderedActions(ordering, state, 4, ttAction);
+  EXPECT_EQ(order[0], Action::DRINK_BEER);
+}
+
+TEST(MoveOrderingTest, StoredMovesKeepSearchValues) {
+  // A search that starts from a shallower search's stored moves visits
+  // actions in another order, but must reach the same value.
+  BotPlayer bot("Bot", 3);
+  const SearchState state = SearchState::fromString(ORDERING_POSITION);
+  bot.clearTranspositionTable();
+  const float cold = bot.searchToDepth(state, 6);
+  bot.clearTranspositionTable();
+  (void)bot.searchToDepth(state, 4);
+  const float warm = bot.searchToDepth(state, 6);
+  EXPECT_NEAR(cold, warm, 0.01f);
+  EXPECT_THROW((void)bot.searchToDepth(state, SearchLimits::MAX_DEPTH + 1),
+               InvalidGameArgumentException);
+}
+
+// ============================================================
+// Thread Pool Tests
+// ============================================================
+
+TEST(ThreadPoolTest, ZeroThreadsThrows) {
+  EXPECT_THROW(ThreadPool pool(0), InvalidGameArgumentException);
+}
+
+TEST(ThreadPoolTest, RunsEverySubmittedTask) {
+  ThreadPool pool(3);
+  EXPECT_EQ(pool.size(), 3u);
+
+  std::atomic<int> total{0};
+  std::vector<std::future<void>> results;
+  for (int i = 1; i <= 100; ++i)
+    results.push_back(pool.submit([&total, i] { total += i; }));
+  for (auto &result : results)
+    result.get();
+  EXPECT_EQ(total.load(), 5050);
+}
+
+TEST(ThreadPoolTest, FutureRethrowsTaskException) {
+  ThreadPool pool(1);
+  auto result = pool.submit([] { throw SimulationException("boom"); });
+  EXPECT_THROW(result.get(), SimulationException);
+}
+
+TEST(BotPlayerTest, SearchThreadsMustBePositive) {
+  BotPlayer bot("Bot", 3);
+  EXPECT_EQ(bot.getSearchThreads(), 1);
+  bot.setSearchThreads(4);
+  EXPECT_EQ(bot.getSearchThreads(), 4);
+  bot.setSearchThreads(1);
+  EXPECT_EQ(bot.getSearchThreads(), 1);
+  EXPECT_THROW(bot.setSearchThreads(0), InvalidGameArgumentException);
+}
+
+TEST(BotPlayerTest, ParallelSearchModeDefaultsToRootSplit) {
+  BotPlayer bot("Bot", 3);
+  EXPECT_EQ(bot.getParallelSearchMode(), ParallelSearchMode::ROOT_SPLIT);
+  bot.setParallelSearchMode(ParallelSearchMode::LAZY_SMP);
+  EXPECT_EQ(bot.getParallelSearchMode(), ParallelSearchMode::LAZY_SMP);
+}
+
+TEST(SearchLimitsTest, InvalidLimitsThrow) {
+  BotPlayer bot("Bot", 3);
+  EXPECT_EQ(bot.getSearchLimits().maxNodes, 0u);
+  EXPECT_EQ(bot.getSearchLimits().maxDepth, SearchLimits::MAX_DEPTH);
+  EXPECT_EQ(bot.getSearchLimits().timeLimit, SearchLimits::DEFAULT_TIME_LIMIT);
+
+  SearchLimits limits;
+  limits.maxDepth = 0;
+  EXPECT_THROW(bot.setSearchLimits(limits), InvalidGameArgumentException);
+  limits.maxDepth = SearchLimits::MAX_DEPTH + 1;
+  EXPECT_THROW(bot.setSearchLimits(limits), InvalidGameArgumentException);
+  limits.maxDepth = 4;
+  limits.timeLimit = std::chrono::milliseconds{-1};
+  EXPECT_THROW(bot.setSearchLimits(limits), InvalidGameArgumentException);
+  EXPECT_EQ(bot.getSearchLimits().maxDepth, SearchLimits::MAX_DEPTH);
+}
+
+namespace {
+// Plays one move of a bot with the given limits from a fixed midgame.
+Action chooseWithLimits(BotPlayer &bot, SimulatedPlayer &opponent,
+                        const SearchLimits &limits) {
+  for (ItemKind kind : {ItemKind::BEER, ItemKind::HANDSAW,
+                        ItemKind::MAGNIFYING_GLASS, ItemKind::HANDCUFFS})
+    bot.addItem(kind);
+  opponent.addItem(ItemKind::BEER);
+  opponent.addItem(ItemKind::MAGNIFYING_GLASS);
+  bot.setSearchLimits(limits);
+  SimulatedShotgun shotgun(7, 4, 3, false);
+  return bot.chooseAction(&shotgun);
+}
+} // namespace
+
+TEST_F(PlayerTestFixture, DepthLimitStopsDeepening) {
+  SimulatedPlayer opponent("Opponent", 3);
+  BotPlayer bot("Bot", 3, &opponent);
+  SearchLimits limits;
+  limits.maxDepth = 3;
+  (void)chooseWithLimits(bot, opponent, limits);
+  EXPECT_EQ(bot.getLastSearchDepth(), 3);
+}
+
+TEST_F(PlayerTestFixture, NodeBudgetPlaysTheSameMoveEveryTime) {
+  SearchLimits limits;
+  limits.maxNodes = 20000;
+  limits.timeLimit = std::chrono::milliseconds{0};
+
+  SimulatedPlayer firstOpponent("Opponent", 3);
+  BotPlayer first("First", 3, &firstOpponent);
+  SimulatedPlayer secondOpponent("Opponent", 3);
+  BotPlayer second("Second", 3, &secondOpponent);
+  EXPECT_EQ(chooseWithLimits(first, firstOpponent, limits),
+            chooseWithLimits(second, secondOpponent, limits));
+  EXPECT_GE(first.getLastSearchDepth(), 5);
+  EXPECT_LT(first.getLastSearchDepth(), SearchLimits::MAX_DEPTH);
+  EXPECT_EQ(first.getLastSearchDepth(), second.getLastSearchDepth());
+  EXPECT_EQ(first.getLastSearchValue(), second.getLastSearchValue());
+
+  // A bigger budget searches deeper.
+  limits.maxNodes = 200000;
+  SimulatedPlayer thirdOpponent("Opponent", 3);
+  BotPlayer third("Third", 3, &thirdOpponent);
+  (void)chooseWithLimits(third, thirdOpponent, limits);
+  EXPECT_GT(third.getLastSearchDepth(), first.getLastSearchDepth());
+}
+
+TEST(BotConfigTest, PresetsAreValid) {
+  for (const char *name : {"fast", "standard", "deep"})
+    EXPECT_NO_THROW(BotConfig::preset(name).validate()) << name;
+  const BotConfig standard = BotConfig::preset("standard");
+  EXPECT_EQ(standard.limits.timeLimit, SearchLimits::DEFAULT_TIME_LIMIT);
+  EXPECT_EQ(standard.minSearchDepth, BotConfig::DEFAULT_MIN_SEARCH_DEPTH);
+  EXPECT_LT(BotConfig::preset("fast").limits.timeLimit,
+            standard.limits.timeLimit);
+  EXPECT_THROW((void)BotConfig::preset("slow"), InvalidGameArgumentException);
+}
+
+TEST(BotConfigTest, InvalidConfigsThrow) {
+  BotPlayer bot("Bot", 3);
+  BotConfig config;
+  config.minSearchDepth = 0;
+  EXPECT_THROW(bot.setConfig(config), InvalidGameArgumentException);
+  config.minSearchDepth = SearchLimits::MAX_DEPTH + 1;
+  EXPECT_THROW(bot.setConfig(config), InvalidGameArgumentException);
+
+  config = BotConfig();
+  config.weights.set("handsaw", -1.0f);
+  EXPECT_THROW(bot.setConfig(config), InvalidGameArgumentException);
+  config.weights.set("handsaw", std::nanf(""));
+  EXPECT_THROW(bot.setConfig(config), InvalidGameArgumentException);
+  // Health alone could then outscore a win.
+  config = BotConfig();
+  config.weights.set("health", EvaluationWeights::TERMINAL_SCORE);
+  EXPECT_THROW(bot.setConfig(config), InvalidGameArgumentException);
+  EXPECT_THROW(config.weights.set("bogus", 1.0f), InvalidGameArgumentException);
+
+  EXPECT_THROW(BotPlayer("Bot", 3, nullptr, config),
+               InvalidGameArgumentException);
+  EXPECT_EQ(bot.getConfig().minSearchDepth,
+            BotConfig::DEFAULT_MIN_SEARCH_DEPTH);
+  EXPECT_EQ(bot.getConfig().weights.health, EvaluationWeights().health);
+}
+
+TEST(BotConfigTest, WeightsChangeTheEvaluation) {
+  // Player one holds handcuffs and has cuffed the opponent.
+  const SearchState state = SearchState::fromString("3 3/H/- 3/-/x 2/2 1 -");
+  const EvaluationWeights standard;
+  EXPECT_EQ(BotPlayer::evaluateState(state, standard),
+            BotPlayer::evaluateState(state));
+
+  EvaluationWeights weights;
+  weights.set("handcuff", standard.handcuff + 100.0f);
+  EXPECT_FLOAT_EQ(BotPlayer::evaluateState(state, weights),
+                  BotPlayer::evaluateState(state) + 100.0f);
+  weights = standard;
+  weights.set("handcuffs-value", standard.itemValues[static_cast<int>(
+                                     ItemKind::HANDCUFFS)] +
+                                     10.0f);
+  EXPECT_FLOAT_EQ(BotPlayer::evaluateState(state, weights),
+                  BotPlayer::evaluateState(state) + 10.0f * standard.item);
+}
+
+TEST(BotConfigTest, WeightsAssignFromText) {
+  EvaluationWeights weights;
+  weights.assign("health=700");
+  EXPECT_EQ(weights.health, 700.0f);
+  weights.assign("beer-value=2.5");
+  EXPECT_EQ(weights.itemValues[static_cast<int>(ItemKind::BEER)], 2.5f);
+  for (const char *text : {"health", "health=", "health=abc", "health=5x",
+                           "health=1e99", "bogus=1"})
+    EXPECT_THROW(weights.assign(text), InvalidGameArgumentException) << text;
+  EXPECT_EQ(weights.health, 700.0f);
+}
+
+TEST(BotConfigTest, WeightsCompareEveryWeight) {
+  EXPECT_EQ(EvaluationWeights(), EvaluationWeights());
+  EvaluationWeights weights;
+  weights.set("shell-distribution", 41.0f);
+  EXPECT_NE(weights, EvaluationWeights());
+  weights = EvaluationWeights();
+  weights.set("magnifying-glass-value", 41.0f);
+  EXPECT_NE(weights, EvaluationWeights());
+}
+
+TEST_F(PlayerTestFixture, ConfiguredBotSearchesWithItsWeights) {
+  // A bot that values nothing but health: after one hit each way the
+  // magazine is empty and the position scores exactly zero.
+  BotConfig config;
+  config.limits.maxDepth = 2;
+  config.limits.timeLimit = std::chrono::milliseconds{0};
+  config.minSearchDepth = 1;
+  for (const char *name : {"item", "turn", "handcuff", "magnifying-glass",
+                           "handsaw", "shell-distribution", "item-synergy"})
+    config.weights.set(name, 0.0f);
+  SimulatedPlayer opponent("Opponent", 3);
+  BotPlayer bot("Bot", 3, &opponent, config);
+  SimulatedShotgun shotgun(2, 2, 0, false);
+  EXPECT_EQ(bot.chooseAction(&shotgun), Action::SHOOT_OPPONENT);
+  EXPECT_EQ(bot.getLastSearchDepth(), 2);
+  EXPECT_FLOAT_EQ(bot.getLastSearchValue(), 0.0f);
+}
+
+TEST_F(PlayerTestFixture, SearchToDepthIsRepeatable) {
+  SimulatedPlayer opponent("Opponent", 2);
+  BotPlayer bot("Bot", 3, &opponent);
+  bot.addItem(ItemKind::MAGNIFYING_GLASS);
+  opponent.addItem(ItemKind::BEER);
+  SimulatedShotgun shotgun(5, 3, 2, false);
+  const SearchState state =
+      SearchState::fromPlayers(bot, opponent, shotgun);
+
+  EXPECT_EQ(bot.searchToDepth(state, 0), BotPlayer::evaluateState(state));
+  const float cold = bot.searchToDepth(state, 6);
+  EXPECT_EQ(bot.searchToDepth(state, 6), cold);
+
+  // A finished chooseAction() leaves nothing behind that stops the search.
+  (void)bot.chooseAction(&shotgun);
+  bot.clearTranspositionTable();
+  EXPECT_EQ(bot.searchToDepth(state, 6), cold);
+}
+
+TEST(SearchStatsTest, CountersAddUp) {
+  SearchCounters counters;
+  counters.recordCutoff(0);
+  counters.recordCutoff(2);
+  // Move indices past the last slot share it.
+  counters.recordCutoff(SearchCounters::CUTOFF_SLOTS + 3);
+  counters.leafEvaluations = 5;
+  EXPECT_EQ(counters.totalCutoffs(), 3u);
+  EXPECT_EQ(counters.cutoffs[SearchCounters::CUTOFF_SLOTS - 1], 1u);
+
+  SearchCounters sum;
+  sum += counters;
+  sum += counters;
+  EXPECT_EQ(sum.totalCutoffs(), 6u);
+  EXPECT_EQ(sum.cutoffs[2], 2u);
+  EXPECT_EQ(sum.leafEvaluations, 10u);
+}
+
+TEST_F(PlayerTestFixture, SearchToDepthReportsStats) {
+  SimulatedPlayer opponent("Opponent", 2);
+  BotPlayer bot("Bot", 3, &opponent);
+  bot.addItem(ItemKind::MAGNIFYING_GLASS);
+  opponent.addItem(ItemKind::BEER);
+  SimulatedShotgun shotgun(5, 3, 2, false);
+  const SearchState state = SearchState::fromPlayers(bot, opponent, shotgun);
+
+  (void)bot.searchToDepth(state, 4);
+  const SearchStats shallow = bot.getLastSearchStats();
+  EXPECT_GT(shallow.nodes, 0u);
+  EXPECT_GT(shallow.counters.leafEvaluations, 0u);
+  EXPECT_GT(shallow.counters.chanceNodes, 0u);
+  EXPECT_EQ(shallow.completedDepth, 4);
+  ASSERT_EQ(shallow.iterations.size(), 1u);
+  EXPECT_EQ(shallow.iterations[0].nodes, shallow.nodes);
+  // Every node below the root is either a leaf or probes the table.
+  EXPECT_EQ(shallow.nodes,
+            shallow.counters.leafEvaluations + shallow.counters.ttProbes);
+
+  bot.clearTranspositionTable();
+  (void)bot.searchToDepth(state, 6);
+  EXPECT_GT(bot.getLastSearchStats().nodes, shallow.nodes);
+}
+
+TEST_F(PlayerTestFixture, ChooseActionReportsEveryIteration) {
+  SimulatedPlayer opponent("Opponent", 3);
+  BotConfig config;
+  config.minSearchDepth = 2;
+  config.limits.maxDepth = 5;
+  config.limits.timeLimit = std::chrono::milliseconds{0};
+  BotPlayer bot("Bot", 3, &opponent, config);
+  bot.addItem(ItemKind::HANDSAW);
+  opponent.addItem(ItemKind::CIGARETTE);
+
+  int calls = 0;
+  SearchStats reported;
+  bot.setSearchStatsCallback([&](const SearchStats &stats) {
+    calls++;
+    reported = stats;
+  });
+  SimulatedShotgun shotgun(6, 3, 3, false);
+  (void)bot.chooseAction(&shotgun);
+
+  const SearchStats &stats = bot.getLastSearchStats();
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(reported.nodes, stats.nodes);
+  EXPECT_EQ(stats.completedDepth, bot.getLastSearchDepth());
+  ASSERT_EQ(stats.iterations.size(), 4u);
+  uint64_t nodes = 0;
+  for (size_t i = 0; i < stats.iterations.size(); ++i) {
+    EXPECT_EQ(stats.iterations[i].depth, 2 + static_cast<int>(i));
+    EXPECT_TRUE(stats.iterations[i].completed);
+    nodes += stats.iterations[i].nodes;
+  }
+  EXPECT_EQ(nodes, stats.nodes);
+  EXPECT_LE(stats.counters.ttHits, stats.counters.ttProbes);
+  EXPECT_LE(stats.counters.ttCutoffs, stats.counters.ttHits);
+}
+
+TEST_F(PlayerTestFixture, ChooseActionReportsPrincipalVariation) {
+  SimulatedPlayer opponent("Opponent", 3);
+  BotConfig config;
+  config.minSearchDepth = 2;
+  config.limits.maxDepth = 6;
+  config.limits.timeLimit = std::chrono::milliseconds{0};
+  BotPlayer bot("Bot", 3, &opponent, config);
+  bot.addItem(ItemKind::HANDSAW);
+  bot.addItem(ItemKind::MAGNIFYING_GLASS);
+  opponent.addItem(ItemKind::BEER);
+  SimulatedShotgun shotgun(6, 3, 3, false);
+  const Action chosen = bot.chooseAction(&shotgun);
+
+  // The line starts with the chosen action and is no deeper than the search.
+  const std::vector<Action> &line =
+      bot.getLastSearchStats().principalVariation;
+  ASSERT_FALSE(line.empty());
+  EXPECT_LE(line.size(), 6u);
+  EXPECT_EQ(line.front(), chosen);
+
+  // A fixed-depth search reports its line too.
+  SearchState state = SearchState::fromString("3 3/SM/- 3/B/- 3/3 1 -");
+  bot.clearTranspositionTable();
+  (void)bot.searchToDepth(state, 4);
+  const std::vector<Action> &searched =
+      bot.getLastSearchStats().principalVariation;
+  ASSERT_FALSE(searched.empty());
+  EXPECT_LE(searched.size(), 4u);
+  const ActionList rootActions = BotPlayer::determineFeasibleActions(state);
+  EXPECT_NE(std::find(rootActions.begin(), rootActions.end(),
+                      searched.front()),
+            rootActions.end());
+}
+
+namespace {
+// Plain expectiminimax with no pruning or table, for checking the search.
+float unprunedValue(SearchState &state, int depth) {
+  if (depth == 0 || state.players[SearchState::PLAYER_ONE].health <= 0 ||
+      state.players[SearchState::PLAYER_TWO].health <= 0 ||
+      state.totalShells() == 0)
+    return BotPlayer::evaluateState(state);
+  float best = state.playerOneTurn ? -std::numeric_limits<float>::infinity()
+                                   : std::numeric_limits<float>::infinity();
+  for (Action action : BotPlayer::determineFeasibleActions(state)) {
+    BotPlayer::ChanceOutcome outcomes[2];
+    const int count = BotPlayer::chanceOutcomes(state, action, outcomes);
+    float value = 0.0f;
+    for (int i = 0; i < count; ++i) {
+      SearchState::UndoRecord undo;
+      state.apply(action, outcomes[i].shell, undo);
+      value += outcomes[i].probability * unprunedValue(state, depth - 1);
+      state.undo(undo);
+    }
+    best = state.playerOneTurn ? std::max(best, value) : std::min(best, value);
+  }
+  return best;
+}
+} // namespace
+
+TEST(SearchPruningTest, PrunedSearchMatchesUnprunedValue) {
+  const char *positions[] = {
+      "3 3/BCHSM/- 2/BHM/- 4/3 1 -", "3 2/BS/- 3/HM/- 3/3 2 -",
+      "4 4/MMS/- 4/BBC/- 2/4 1 -",   "2 1/H/- 2/S/- 1/2 2 s",
+      "3 3/SM/l 1/C/x 2/1 1 s"};
+  BotPlayer bot("Bot", 3);
+  uint64_t chanceCutoffs = 0;
+  for (const char *text : positions) {
+    SearchState state = SearchState::fromString(text);
+    for (int depth = 1; depth <= 4; ++depth) {
+      bot.clearTranspositionTable();
+      EXPECT_NEAR(bot.searchToDepth(state, depth),
+                  unprunedValue(state, depth), 0.01f)
+          << text << " at depth " << depth;
+      chanceCutoffs += bot.getLastSearchStats().counters.chanceCutoffs;
+    }
+  }
+  // Star1 windows let chance nodes stop after their first shell.
+  EXPECT_GT(chanceCutoffs, 0u);
+}
+
+TEST(SearchPruningTest, DecidedNodeMatchesUnprunedValue) {
+  // In the first position player one finds a forced win, so alpha reaches
+  // TERMINAL_WIN_SCORE; in the second player two finds one, so beta reaches
+  // TERMINAL_LOSS_SCORE.  The Star1 windows of the chance nodes searched
+  // after that clip to nothing or round shut, and a bound searched in such
+  // a window must not come back as an exact value.
+  const char *positions[] = {"2 2/-/- 1/MBB/- 3/3 2 -",
+                             "2 1/-/- 2/MB/- 2/3 1 -"};
+  BotPlayer bot("Bot", 3);
+  for (const char *text : positions) {
+    SearchState state = SearchState::fromString(text);
+    for (int depth = 1; depth <= 6; ++depth) {
+      bot.clearTranspositionTable();
+      EXPECT_NEAR(bot.searchToDepth(state, depth),
+                  unprunedValue(state, depth), 0.01f)
+          << text << " at depth " << depth;
+    }
+  }
+}
+
+TEST_F(PlayerTestFixture, NarrowedRootMatchesFullWindowRoot) {
+  // One thread narrows the root window after the first action; root-split
+  // tasks search every action with a full window.  Both must agree.
+  BotConfig config;
+  config.minSearchDepth = 5;
+  config.limits.maxDepth = 5;
+  config.limits.timeLimit = std::chrono::milliseconds{0};
+  const std::vector<ItemKind> botItems = {ItemKind::BEER, ItemKind::HANDSAW,
+                                          ItemKind::MAGNIFYING_GLASS};
+  const std::vector<ItemKind> opponentItems = {ItemKind::CIGARETTE,
+                                               ItemKind::HANDCUFFS};
+  float values[2];
+  Action actions[2];
+  for (int threads = 1; threads <= 2; ++threads) {
+    SimulatedPlayer opponent("Opponent", 3);
+    BotPlayer bot("Bot", 3, &opponent, config);
+    bot.setSearchThreads(threads);
+    for (ItemKind kind : botItems)
+      bot.addItem(kind);
+    for (ItemKind kind : opponentItems)
+      opponent.addItem(kind);
+    SimulatedShotgun shotgun(5, 2, 3, false);
+    actions[threads - 1] = bot.chooseAction(&shotgun);
+    values[threads - 1] = bot.getLastSearchValue();
+  }
+  EXPECT_EQ(actions[0], actions[1]);
+  EXPECT_NEAR(values[0], values[1], 0.01f);
+}
+
+TEST_F(PlayerTestFixture, LazySmpChoosesSameActionAsSingleThread) {
+  SimulatedPlayer opponent("Opponent", 1);
+  BotPlayer single("Single", 3, &opponent);
+  BotPlayer lazy("Lazy", 3, &opponent);
+  lazy.setSearchThreads(3);
+  lazy.setParallelSearchMode(ParallelSearchMode::LAZY_SMP);
+
+  // A known live shell against a one-HP opponent has a single best answer.
+  SimulatedShotgun first(3, 2, 1, false);
+  SimulatedShotgun second(3, 2, 1, false);
+  single.setKnownNextShell(ShellType::LIVE_SHELL);
+  lazy.setKnownNextShell(ShellType::LIVE_SHELL);
+  EXPECT_EQ(single.chooseAction(&first), Action::SHOOT_OPPONENT);
+  EXPECT_EQ(lazy.chooseAction(&second), Action::SHOOT_OPPONENT);
+}
+
+// ============================================================
+// Tablebase Tests
+// ============================================================
+
+namespace {
+// Health 3, at most one item per side: small enough to solve per test run.
+const Tablebase &smallTablebase() {
+  static const Tablebase table = Tablebase::generate(3, 1);
+  return table;
+}
+
+SearchState tablebasePosition(int live, int blank, bool playerOneTurn) {
+  auto *p1 = new SimulatedPlayer("Alice", 3);
+  auto *p2 = new SimulatedPlayer("Bob", 2);
+  p1->addItem(std::make_unique<Handsaw>());
+  p2->addItem(std::make_unique<MagnifyingGlass>());
+  SimulatedGame game(p1, p2,
+                     new SimulatedShotgun(live + blank, live, blank, false),
+                     playerOneTurn);
+  return SearchState::fromGame(game);
+}
+} // namespace
+
+TEST(TablebaseTest, GenerateRejectsBadLimits) {
+  EXPECT_THROW((void)Tablebase::generate(0), InvalidGameArgumentException);
+  EXPECT_THROW((void)Tablebase::generate(3, -1), InvalidGameArgumentException);
+}
+
+TEST_F(PlayerTestFixture, TablebaseCoversSmallInMagazinePositions) {
+  const Tablebase &table = smallTablebase();
+  EXPECT_TRUE(table.covers(tablebasePosition(2, 1, true)));
+  EXPECT_TRUE(table.covers(tablebasePosition(2, 1, false)));
+  EXPECT_FALSE(table.covers(tablebasePosition(0, 0, true)));
+
+  SearchState tooManyItems = tablebasePosition(2, 1, true);
+  tooManyItems.players[SearchState::PLAYER_ONE]
+      .items[static_cast<int>(ItemKind::BEER)] = 1;
+  EXPECT_FALSE(table.covers(tooManyItems));
+
+  SearchState otherHealthCap = tablebasePosition(2, 1, true);
+  otherHealthCap.maxHealth = 4;
+  EXPECT_FALSE(table.covers(otherHealthCap));
+}
+
+TEST_F(PlayerTestFixture, TablebaseProbeIsBestActionValue) {
+  const Tablebase &table = smallTablebase();
+  for (bool playerOneTurn : {true, false}) {
+    SearchState state = tablebasePosition(2, 2, playerOneTurn);
+    float value;
+    ASSERT_TRUE(table.probe(state, value));
+
+    // Player one maximises and player two minimises over the same actions.
+    float best = playerOneTurn ? -INFINITY : INFINITY;
+    for (Action action : BotPlayer::determineFeasibleActions(state)) {
+      float actionValue;
+      ASSERT_TRUE(table.actionValue(state, action, actionValue));
+      best = playerOneTurn ? std::max(best, actionValue)
+                           : std::min(best, actionValue);
+    }
+    EXPECT_EQ(value, best);
+  }
+}
+
+TEST_F(PlayerTestFixture, TablebaseMirroredPositionNegatesValue) {
+  const Tablebase &table = smallTablebase();
+  SearchState state = tablebasePosition(1, 3, false);
+  float value;
+  float mirroredValue;
+  ASSERT_TRUE(table.probe(state, value));
+  ASSERT_TRUE(table.probe(state.mirrored(), mirroredValue));
+  EXPECT_EQ(value, -mirroredValue);
+}
+
+TEST_F(PlayerTestFixture, TablebaseSaveOpenRoundTrip) {
+  const Tablebase &table = smallTablebase();
+  const std::string path = ::testing::TempDir() + "tablebase_test.bin";
+  table.save(path);
+  Tablebase opened = Tablebase::open(path);
+
+  EXPECT_EQ(opened.size(), table.size());
+  EXPECT_EQ(opened.sectionCount(), 1u);
+  EXPECT_TRUE(opened.hasSection(3));
+  EXPECT_EQ(opened.getMaxItemsPerSide(3), 1);
+  SearchState state = tablebasePosition(3, 2, true);
+  float original;
+  float mapped;
+  ASSERT_TRUE(table.probe(state, original));
+  ASSERT_TRUE(opened.probe(state, mapped));
+  EXPECT_EQ(original, mapped);
+  std::remove(path.c_str());
+}
+
+TEST_F(PlayerTestFixture, TablebaseSectionsAreChosenByMaxHealth) {
+  Tablebase table = Tablebase::generate(2, 0);
+  table.addSections(Tablebase::generate(3, 0));
+  EXPECT_THROW(table.addSections(Tablebase::generate(3, 0)),
+               InvalidGameArgumentException);
+
+  const std::string path = ::testing::TempDir() + "tablebase_sections.bin";
+  table.save(path);
+  Tablebase opened = Tablebase::open(path);
+  EXPECT_EQ(opened.sectionCount(), 2u);
+  EXPECT_FALSE(opened.hasSection(4));
+
+  auto *p1 = new SimulatedPlayer("Alice", 2);
+  auto *p2 = new SimulatedPlayer("Bob", 2);
+  SimulatedGame game(p1, p2, new SimulatedShotgun(3, 1, 2, false), true);
+  SearchState state = SearchState::fromGame(game);
+  for (int maxHealth : {2, 3}) {
+    state.maxHealth = static_cast<int8_t>(maxHealth);
+    float generated;
+    float mapped;
+    ASSERT_TRUE(table.probe(state, generated));
+    ASSERT_TRUE(opened.probe(state, mapped));
+    EXPECT_EQ(generated, mapped);
+  }
+  state.maxHealth = 4;
+  EXPECT_FALSE(opened.covers(state));
+  std::remove(path.c_str());
+}
+
+TEST(TablebaseTest, OpenRejectsMissingForeignOrTruncatedFiles) {
+  const std::string path = ::testing::TempDir() + "not_a_tablebase.bin";
+  EXPECT_THROW((void)Tablebase::open(path), TablebaseException);
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << "definitely not a tablebase";
+  }
+  EXPECT_THROW((void)Tablebase::open(path), TablebaseException);
+
+  // A real table cut short must not map past the end of the file.
+  Tablebase::generate(2, 0).save(path);
+  std::string contents;
+  {
+    std::ifstream in(path, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(in), {});
+  }
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(contents.data(),
+              static_cast<std::streamsize>(contents.size() / 2));
+  }
+  EXPECT_THROW((void)Tablebase::open(path), TablebaseException);
+  std::remove(path.c_str());
+}
+
+TEST(TablebaseTest, StartupSkipsMissingOldOrTruncatedFiles) {
+  const std::string path = ::testing::TempDir() + "startup_tablebase.bin";
+  std::remove(path.c_str());
+  std::ostringstream warnings;
+  EXPECT_EQ(Tablebase::openIfUsable(path, warnings), nullptr);
+  EXPECT_TRUE(warnings.str().empty());
+
+  Tablebase::generate(2, 0).save(path);
+  EXPECT_NE(Tablebase::openIfUsable(path, warnings), nullptr);
+  EXPECT_TRUE(warnings.str().empty());
+  std::string contents;
+  {
+    std::ifstream in(path, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(in), {});
+  }
+
+  // A table written by the first generator, whose version field was 1.
+  std::string oldVersion = contents;
+  const uint32_t version = 1;
+  std::memcpy(oldVersion.data() + 4, &version, sizeof(version));
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << oldVersion;
+  }
+  EXPECT_EQ(Tablebase::openIfUsable(path, warnings), nullptr);
+  EXPECT_NE(warnings.str().find("regenerate"), std::string::npos);
+
+  warnings.str("");
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(contents.data(),
+              static_cast<std::streamsize>(contents.size() / 2));
+  }
+  EXPECT_EQ(Tablebase::openIfUsable(path, warnings), nullptr);
+  EXPECT_NE(warnings.str().find("regenerate"), std::string::npos);
+  std::remove(path.c_str());
+}
+
+TEST_F(PlayerTestFixture, ChooseActionPlaysFromTablebase) {
+  SimulatedPlayer opponent("Opponent", 1);
+  BotPlayer bot("Bot", 3, &opponent);
+  bot.setTablebase(std::make_shared<const Tablebase>(Tablebase::generate(3, 0)));
+
+  // Every remaining shell is live and the opponent is on one HP.
+  SimulatedShotgun shotgun(2, 2, 0, false);
+  EXPECT_EQ(bot.chooseAction(&shotgun), Action::SHOOT_OPPONENT);
+  EXPECT_EQ(bot.getLastSearchDepth(), 0);
+}
+
+TEST_F(PlayerTestFixture, TunedBotSearchesInsteadOfProbing) {
+  // The table holds values under the default weights, which this bot does
+  // not share.
+  BotConfig config;
+  config.limits.maxDepth = 3;
+  config.limits.timeLimit = std::chrono::milliseconds{0};
+  config.minSearchDepth = 1;
+  config.weights.set("health", 700.0f);
+  SimulatedPlayer opponent("Opponent", 1);
+  BotPlayer bot("Bot", 3, &opponent, config);
+  bot.setTablebase(std::make_shared<const Tablebase>(Tablebase::generate(3, 0)));
+
+  SimulatedShotgun shotgun(2, 2, 0, false);
+  EXPECT_EQ(bot.chooseAction(&shotgun), Action::SHOOT_OPPONENT);
+  EXPECT_EQ(bot.getLastSearchDepth(), 3);
+  EXPECT_GT(bot.getLastSearchStats().nodes, 0u);
+}
\ No newline at end of file